@@ -36,12 +36,14 @@
 // QXmpp
 #include <QXmppUtils.h>
 // Kaidan
+#include "DiscoveryDb.h"
 #include "Globals.h"
 #include "Kaidan.h"
 #include "MessageModel.h"
 #include "RosterModel.h"
 #include "Settings.h"
 #include "VCardCache.h"
+#include "VCardDb.h"
 
 AccountManager *AccountManager::s_instance = nullptr;
 
@@ -284,6 +286,8 @@ void AccountManager::removeAccount(const QString &accountJid)
 
 	emit MessageModel::instance()->removeMessagesRequested(accountJid);
 	emit RosterModel::instance()->removeItemsRequested(accountJid);
+	emit DiscoveryDb::instance()->removeDiscoInfosRequested(QXmppUtils::jidToDomain(accountJid));
+	emit VCardDb::instance()->removeVCardsRequested();
 }
 
 QString AccountManager::generateJidResourceWithRandomSuffix(unsigned int numberOfRandomSuffixCharacters) const
@@ -29,52 +29,73 @@
  */
 
 #include "AvatarFileStorage.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iterator>
+
 // Qt
 #include <QCryptographicHash>
 #include <QDebug>
 #include <QDir>
+#include <QMutexLocker>
+#include <QSaveFile>
 #include <QStandardPaths>
+#include <QTextStream>
+#include <QTimer>
 #include <QUrl>
+// Kaidan
+#include "Globals.h"
+
+using namespace std::chrono_literals;
+
+// compacted mapping of JIDs to hashes ("<HASH> <JID>" per line)
+const auto AVATAR_LIST_FILE_NAME = QStringLiteral("avatar_list.sha1");
+
+// changes of the mapping since the last compaction ("<HASH> <JID>" or "- <JID>" per line)
+const auto AVATAR_JOURNAL_FILE_NAME = QStringLiteral("avatar_list.journal");
+
+// hash part of a journal entry for a removed avatar
+const auto AVATAR_REMOVAL_MARKER = QStringLiteral("-");
 
-AvatarFileStorage::AvatarFileStorage(QObject *parent) : QObject(parent)
+// time for collecting changes before they are written to the journal
+constexpr auto AVATAR_JOURNAL_WRITE_DELAY = 1s;
+
+// number of journal entries below which the journal is never compacted
+constexpr int AVATAR_JOURNAL_MIN_COMPACTION_SIZE = 100;
+
+AvatarFileStorage::AvatarFileStorage(QObject *parent)
+	: QObject(parent),
+	  m_avatarsDirectoryPath(QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + QDir::separator() + QStringLiteral("avatars")),
+	  m_journalWriteTimer(new QTimer(this))
 {
+	m_journalWriteTimer->setSingleShot(true);
+	m_journalWriteTimer->setInterval(AVATAR_JOURNAL_WRITE_DELAY);
+	m_journalWriteTimer->callOnTimeout(this, &AvatarFileStorage::writeJournal);
+
 	// create avatar directory, if it doesn't exists
-	QDir cacheDir(QStandardPaths::writableLocation(QStandardPaths::CacheLocation));
-	if (!cacheDir.exists("avatars"))
-		cacheDir.mkpath("avatars");
-
-	// search for the avatar list file (hash <-> jid)
-	QString avatarFilePath = getAvatarPath("avatar_list.sha1");
-
-	try {
-		// check if file was found
-		if (avatarFilePath != "") {
-			//
-			// restore saved avatars
-			//
-
-			// open the file; if fails return
-			QFile avatarFile(avatarFilePath);
-			if (!avatarFile.open(QIODevice::ReadOnly))
-				return;
-
-			QTextStream stream(&avatarFile);
-			// get the first line
-			QString line = stream.readLine();
-			while (!line.isNull()) {
-				// get hash and jid from line (seperated by a blank)
-				QStringList list = line.split(' ', Qt::SkipEmptyParts);
-
-				// set the hash for the jid
-				m_jidAvatarMap[list.at(1)] = list.at(0);
-
-				// read the next line
-				line = stream.readLine();
-			};
-		}
-	} catch (...) {
-		qDebug() << "[AvatarFileStorage] Error in" << avatarFilePath << "(avatar list file)";
+	QDir avatarsDir(m_avatarsDirectoryPath);
+	if (!avatarsDir.exists())
+		avatarsDir.mkpath(QStringLiteral("."));
+
+	// The directory is only listed once so that lookups do not need to access the file system.
+	const auto fileNames = avatarsDir.entryList(QDir::Files);
+	for (const auto &fileName : fileNames) {
+		if (fileName != AVATAR_LIST_FILE_NAME && fileName != AVATAR_JOURNAL_FILE_NAME && !fileName.contains('_'))
+			m_storedHashes.insert(fileName);
 	}
+
+	// restore saved avatars
+	loadAvatarList(AVATAR_LIST_FILE_NAME);
+	m_journalEntryCount = loadAvatarList(AVATAR_JOURNAL_FILE_NAME);
+
+	for (const auto &hash : qAsConst(m_jidAvatarMap))
+		++m_hashReferenceCounts[hash];
+}
+
+AvatarFileStorage::~AvatarFileStorage()
+{
+	writeJournal();
 }
 
 AvatarFileStorage::AddAvatarResult AvatarFileStorage::addAvatar(const QString &jid,
@@ -84,86 +105,83 @@ AvatarFileStorage::AddAvatarResult AvatarFileStorage::addAvatar(const QString &j
 
 	// generate a hexadecimal hash of the raw avatar
 	result.hash = QString(QCryptographicHash::hash(avatar, QCryptographicHash::Sha1).toHex());
-	QString oldHash = m_jidAvatarMap[jid];
 
-	// set the new hash and the `hasChanged` tag
-	if (oldHash != result.hash) {
-		m_jidAvatarMap[jid] = result.hash;
-		result.hasChanged = true;
+	bool isAvatarStored;
+	{
+		QMutexLocker locker(&m_mutex);
+		const auto oldHash = m_jidAvatarMap.value(jid);
 
-		// delete the avatar if it isn't used anymore
-		cleanUp(oldHash);
-	}
+		// set the new hash and the `hasChanged` tag
+		if (oldHash != result.hash) {
+			setHashOfJid(jid, result.hash);
+			result.hasChanged = true;
 
-	// abort if the avatar with this hash is already saved
-	// only update GUI, if avatar really has changed
-	if (hasAvatarHash(result.hash)) {
-		if (result.hasChanged)
-			emit avatarIdsChanged();
-		return result;
-	}
+			// delete the avatar if it isn't used anymore
+			removeUnusedAvatar(oldHash);
+		}
 
-	// write the avatar to disk:
-	// get the writable cache location for writing
-	QFile file(QStandardPaths::writableLocation(QStandardPaths::CacheLocation) +
-		   QDir::separator() + QString("avatars") + QDir::separator() + result.hash);
-	if (!file.open(QIODevice::WriteOnly))
-		return result;
+		isAvatarStored = m_storedHashes.contains(result.hash);
+	}
 
-	// write the binary avatar
-	file.write(avatar);
+	// write the avatar to disk if the avatar with this hash is not already saved
+	if (!isAvatarStored) {
+		QSaveFile file(avatarFilePath(result.hash));
+		if (file.open(QIODevice::WriteOnly) && file.write(avatar) == avatar.size() && file.commit()) {
+			QMutexLocker locker(&m_mutex);
+			m_storedHashes.insert(result.hash);
 
-	saveAvatarsFile();
+			// mark that the avatar is new
+			result.newWritten = true;
+		} else {
+			qWarning() << "[AvatarFileStorage] Could not write avatar" << result.hash << ":" << file.errorString();
+		}
+	}
 
-	// mark that the avatar is new
-	result.newWritten = true;
+	// only update GUI, if avatar really has changed
+	if (result.hasChanged || result.newWritten)
+		emit avatarIdsChanged();
 
-	emit avatarIdsChanged();
 	return result;
 }
 
 void AvatarFileStorage::clearAvatar(QString &jid)
 {
-	QString oldHash;
-	if (m_jidAvatarMap.contains(jid))
-		oldHash = m_jidAvatarMap[jid];
+	{
+		QMutexLocker locker(&m_mutex);
+		const auto oldHash = m_jidAvatarMap.value(jid);
 
-	// if user had no avatar before, just return
-	if (oldHash.isEmpty())
-		return;
+		// if user had no avatar before, just return
+		if (oldHash.isEmpty())
+			return;
+
+		setHashOfJid(jid, {});
+		removeUnusedAvatar(oldHash);
+	}
 
-	m_jidAvatarMap.remove(jid);
-	saveAvatarsFile();
-	cleanUp(oldHash);
 	emit avatarIdsChanged();
 }
 
 void AvatarFileStorage::cleanUp(QString &oldHash)
 {
-	if (oldHash.isEmpty())
-		return;
-
-	// check if the same avatar is still used by another account
-	if (std::find(m_jidAvatarMap.cbegin(), m_jidAvatarMap.cend(), oldHash) != m_jidAvatarMap.cend())
-		return;
-
-	// delete the old avatar locally
-	QString path = QStandardPaths::writableLocation(QStandardPaths::CacheLocation) +
-		       QDir::separator() + QString("avatars");
-	QDir dir(path);
-	if (dir.exists(oldHash))
-		dir.remove(oldHash);
+	QMutexLocker locker(&m_mutex);
+	removeUnusedAvatar(oldHash);
 }
 
 QString AvatarFileStorage::getAvatarPath(const QString &hash) const
 {
-	return QStandardPaths::locate(QStandardPaths::CacheLocation, QString("avatars") +
-		QDir::separator() + hash, QStandardPaths::LocateFile);
+	QMutexLocker locker(&m_mutex);
+	return m_storedHashes.contains(hash) ? avatarFilePath(hash) : QString();
+}
+
+QString AvatarFileStorage::getAvatarVariantPath(const QString &hash, int size) const
+{
+	return avatarFilePath(hash + QLatin1Char('_') + QString::number(size) + QStringLiteral(".png"));
 }
 
 QString AvatarFileStorage::getHashOfJid(const QString& jid) const
 {
-	return m_jidAvatarMap[jid];
+	QMutexLocker locker(&m_mutex);
+	return m_jidAvatarMap.value(jid);
 }
 
 QString AvatarFileStorage::getAvatarPathOfJid(const QString& jid) const
@@ -171,28 +189,174 @@ QString AvatarFileStorage::getAvatarPathOfJid(const QString& jid) const
 	return getAvatarPath(getHashOfJid(jid));
 }
 
-QString AvatarFileStorage::getAvatarUrl(const QString &jid) const
+QString AvatarFileStorage::getAvatarUrl(const QString &jid, int size) const
 {
-	return QUrl::fromLocalFile(getAvatarPathOfJid(jid)).toString();
+	const auto hash = getHashOfJid(jid);
+
+	if (size > 0 && size <= std::end(AVATAR_VARIANT_SIZES)[-1] && hasAvatarHash(hash))
+		return QStringLiteral("image://" AVATAR_IMAGE_PROVIDER_NAME "/") + hash;
+
+	return QUrl::fromLocalFile(getAvatarPath(hash)).toString();
 }
 
 bool AvatarFileStorage::hasAvatarHash(const QString& hash) const
 {
-	return !getAvatarPath(hash).isNull();
+	QMutexLocker locker(&m_mutex);
+	return m_storedHashes.contains(hash);
+}
+
+int AvatarFileStorage::loadAvatarList(const QString &fileName)
+{
+	QFile file(avatarFilePath(fileName));
+	if (!file.exists())
+		return 0;
+
+	if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+		qWarning() << "[AvatarFileStorage] Could not open" << file.fileName() << ":" << file.errorString();
+		return 0;
+	}
+
+	int entryCount = 0;
+	QTextStream stream(&file);
+	for (auto line = stream.readLine(); !line.isNull(); line = stream.readLine()) {
+		// get hash and jid from line (seperated by a blank)
+		const auto entry = line.split(' ', Qt::SkipEmptyParts);
+
+		// skip lines which were not completely written
+		if (entry.size() != 2)
+			continue;
+
+		if (entry.at(0) == AVATAR_REMOVAL_MARKER)
+			m_jidAvatarMap.remove(entry.at(1));
+		else
+			m_jidAvatarMap.insert(entry.at(1), entry.at(0));
+
+		entryCount++;
+	}
+
+	return entryCount;
+}
+
+void AvatarFileStorage::setHashOfJid(const QString &jid, const QString &hash)
+{
+	const auto oldHash = m_jidAvatarMap.value(jid);
+
+	if (hash.isEmpty()) {
+		m_jidAvatarMap.remove(jid);
+	} else {
+		m_jidAvatarMap.insert(jid, hash);
+		++m_hashReferenceCounts[hash];
+	}
+
+	if (!oldHash.isEmpty()) {
+		if (auto itr = m_hashReferenceCounts.find(oldHash); itr != m_hashReferenceCounts.end() && --*itr <= 0)
+			m_hashReferenceCounts.erase(itr);
+	}
+
+	m_pendingJournalEntries << (hash.isEmpty() ? AVATAR_REMOVAL_MARKER : hash) + QLatin1Char(' ') + jid;
+	scheduleJournalWrite();
+}
+
+void AvatarFileStorage::removeUnusedAvatar(const QString &hash)
+{
+	if (hash.isEmpty() || m_hashReferenceCounts.contains(hash))
+		return;
+
+	// delete the old avatar and its scaled variants locally
+	if (m_storedHashes.remove(hash)) {
+		QFile::remove(avatarFilePath(hash));
+
+		for (const auto size : AVATAR_VARIANT_SIZES)
+			QFile::remove(getAvatarVariantPath(hash, size));
+	}
+}
+
+QString AvatarFileStorage::avatarFilePath(const QString &fileName) const
+{
+	return m_avatarsDirectoryPath + QDir::separator() + fileName;
 }
 
-void AvatarFileStorage::saveAvatarsFile()
+void AvatarFileStorage::scheduleJournalWrite()
 {
-	QString path = QStandardPaths::writableLocation(QStandardPaths::CacheLocation) +
-	               QDir::separator() + QString("avatars") + QDir::separator() +
-	               QString("avatar_list.sha1");
-	QFile file(path);
-	if (!file.open(QIODevice::WriteOnly | QIODevice::Text))
+	if (m_isJournalWriteScheduled)
 		return;
 
+	m_isJournalWriteScheduled = true;
+
+	// The timer must be started from its own thread.
+	QMetaObject::invokeMethod(m_journalWriteTimer, QOverload<>::of(&QTimer::start));
+}
+
+void AvatarFileStorage::writeJournal()
+{
+	// The files are accessed without locking the mapping so that lookups are not blocked.
+	QMutexLocker journalLocker(&m_journalMutex);
+
+	QStringList entries;
+	{
+		QMutexLocker locker(&m_mutex);
+		m_isJournalWriteScheduled = false;
+		entries.swap(m_pendingJournalEntries);
+	}
+
+	if (entries.isEmpty())
+		return;
+
+	// The entries are appended before a compaction so that the journal replayed after an
+	// interruption of the compaction results in the same mapping as the compacted list.
+	QFile file(avatarFilePath(AVATAR_JOURNAL_FILE_NAME));
+	if (!file.open(QIODevice::WriteOnly | QIODevice::Append | QIODevice::Text)) {
+		qWarning() << "[AvatarFileStorage] Could not open" << file.fileName() << ":" << file.errorString();
+
+		// keep the entries for the next write
+		QMutexLocker locker(&m_mutex);
+		m_pendingJournalEntries = entries + m_pendingJournalEntries;
+		return;
+	}
+
 	QTextStream out(&file);
-	const QStringList jidAvatarKeys = m_jidAvatarMap.keys();
-	for (const auto &jid : jidAvatarKeys)
-		/*     < HASH >            < JID >  */
-		out << m_jidAvatarMap[jid] << " " << jid << "\n";
+	for (const auto &entry : qAsConst(entries))
+		out << entry << "\n";
+	out.flush();
+	file.close();
+
+	// Changes made after copying the mapping are pending and written to the new journal.
+	QHash<QString, QString> jidAvatarMap;
+	{
+		QMutexLocker locker(&m_mutex);
+		m_journalEntryCount += entries.size();
+
+		if (m_journalEntryCount <= std::max(AVATAR_JOURNAL_MIN_COMPACTION_SIZE, int(m_jidAvatarMap.size())))
+			return;
+
+		jidAvatarMap = m_jidAvatarMap;
+	}
+
+	if (compactJournal(jidAvatarMap)) {
+		QMutexLocker locker(&m_mutex);
+		m_journalEntryCount = 0;
+	}
+}
+
+bool AvatarFileStorage::compactJournal(const QHash<QString, QString> &jidAvatarMap)
+{
+	QSaveFile file(avatarFilePath(AVATAR_LIST_FILE_NAME));
+	if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+		qWarning() << "[AvatarFileStorage] Could not open" << file.fileName() << ":" << file.errorString();
+		return false;
+	}
+
+	QTextStream out(&file);
+	for (auto itr = jidAvatarMap.cbegin(); itr != jidAvatarMap.cend(); ++itr)
+		/*     < HASH >          < JID >  */
+		out << itr.value() << " " << itr.key() << "\n";
+	out.flush();
+
+	if (!file.commit()) {
+		qWarning() << "[AvatarFileStorage] Could not write" << file.fileName() << ":" << file.errorString();
+		return false;
+	}
+
+	QFile::remove(avatarFilePath(AVATAR_JOURNAL_FILE_NAME));
+	return true;
 }
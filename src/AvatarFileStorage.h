@@ -30,15 +30,31 @@
 
 #pragma once
 
+// Qt
+#include <QHash>
+#include <QMutex>
 #include <QObject>
-#include <QMap>
+#include <QSet>
+#include <QStringList>
 
+class QTimer;
+
+/**
+ * Stores avatars in the cache location and maps JIDs to the hashes of their avatars.
+ *
+ * The mapping is kept in memory together with the number of JIDs using each avatar.
+ * Changes are appended in batches to a journal which is compacted into the avatar list
+ * file once it grows larger than the mapping itself.
+ *
+ * All public methods are thread-safe.
+ */
 class AvatarFileStorage : public QObject
 {
 	Q_OBJECT
 
 public:
 	AvatarFileStorage(QObject *parent = nullptr);
+	~AvatarFileStorage() override;
 
 	struct AddAvatarResult {
 		/* SHA1 HEX Hash */
@@ -84,21 +100,85 @@ public:
 	 */
 	QString getAvatarPath(const QString &hash) const;
 
+	/**
+	 * Returns the path of an avatar's variant scaled to one of AVATAR_VARIANT_SIZES
+	 *
+	 * The returned file does not necessarily exist.
+	 */
+	QString getAvatarVariantPath(const QString &hash, int size) const;
+
 	/**
 	 * Returns the hash of the avatar of the JID
 	 */
 	Q_INVOKABLE QString getHashOfJid(const QString &jid) const;
 
 	/**
-	 * Returns a file URL to the avatar image of a given JID
+	 * Returns a URL to the avatar image of a given JID
+	 *
+	 * @param jid JID whose avatar is requested
+	 * @param size size in pixels the avatar is displayed with or 0 if it is unknown
+	 *
+	 * @return URL of the AvatarImageProvider if the avatar fits into one of
+	 * AVATAR_VARIANT_SIZES, otherwise a file URL to the original avatar image
 	 */
-	Q_INVOKABLE QString getAvatarUrl(const QString &jid) const;
+	Q_INVOKABLE QString getAvatarUrl(const QString &jid, int size = 0) const;
 
 signals:
 	void avatarIdsChanged();
 
 private:
-	void saveAvatarsFile();
+	/**
+	 * Applies the entries of an avatar list or journal file to the mapping.
+	 *
+	 * @return number of applied entries
+	 */
+	int loadAvatarList(const QString &fileName);
+
+	/**
+	 * Sets the hash of a JID's avatar, updates the reference counts and adds a journal
+	 * entry for the change.
+	 *
+	 * @param jid JID whose avatar changed
+	 * @param hash hash of the new avatar or an empty string if the avatar is removed
+	 */
+	void setHashOfJid(const QString &jid, const QString &hash);
+
+	/**
+	 * Deletes the avatar file of the hash if no JID uses it anymore.
+	 */
+	void removeUnusedAvatar(const QString &hash);
+
+	QString avatarFilePath(const QString &fileName) const;
 
-	QMap<QString, QString> m_jidAvatarMap;
+	void scheduleJournalWrite();
+
+	/**
+	 * Appends the pending journal entries to the journal and compacts it if needed.
+	 *
+	 * The mapping is only locked while taking the pending entries and copying the mapping
+	 * but not while writing the files.
+	 */
+	void writeJournal();
+
+	/**
+	 * Replaces the avatar list file by a copy of the mapping and removes the journal.
+	 *
+	 * @param jidAvatarMap mapping of JIDs to hashes to be written
+	 *
+	 * @return whether the avatar list file could be written
+	 */
+	bool compactJournal(const QHash<QString, QString> &jidAvatarMap);
+
+	mutable QMutex m_mutex;
+	// serializes the writing of the journal and the avatar list file
+	QMutex m_journalMutex;
+	QString m_avatarsDirectoryPath;
+	QHash<QString, QString> m_jidAvatarMap;
+	QHash<QString, int> m_hashReferenceCounts;
+	QSet<QString> m_storedHashes;
+
+	QStringList m_pendingJournalEntries;
+	int m_journalEntryCount = 0;
+	bool m_isJournalWriteScheduled = false;
+	QTimer *m_journalWriteTimer;
 };
@@ -0,0 +1,119 @@
+/*
+ *  Kaidan - A user-friendly XMPP client for every device!
+ *
+ *  Copyright (C) 2016-2021 Kaidan developers and contributors
+ *  (see the LICENSE file for a full list of copyright authors)
+ *
+ *  Kaidan is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  In addition, as a special exception, the author of Kaidan gives
+ *  permission to link the code of its release with the OpenSSL
+ *  project's "OpenSSL" library (or with modified versions of it that
+ *  use the same license as the "OpenSSL" library), and distribute the
+ *  linked executables. You must obey the GNU General Public License in
+ *  all respects for all of the code used other than "OpenSSL". If you
+ *  modify this file, you may extend this exception to your version of
+ *  the file, but you are not obligated to do so.  If you do not wish to
+ *  do so, delete this exception statement from your version.
+ *
+ *  Kaidan is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Kaidan.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "AvatarImageProvider.h"
+
+#include <algorithm>
+#include <iterator>
+
+// Qt
+#include <QDebug>
+#include <QImageReader>
+#include <QSaveFile>
+// Kaidan
+#include "AsyncImageResponse.h"
+#include "AvatarFileStorage.h"
+#include "Globals.h"
+
+// maximum number of bytes of the decoded avatars kept in memory
+constexpr int AVATAR_IMAGE_CACHE_SIZE = 16 * 1024 * 1024;
+
+// maximum number of avatars decoded at once
+constexpr int AVATAR_IMAGE_MAX_THREADS = 2;
+
+AvatarImageProvider::AvatarImageProvider(AvatarFileStorage *avatarStorage)
+	: m_avatarStorage(avatarStorage), m_cache(AVATAR_IMAGE_CACHE_SIZE)
+{
+	m_threadPool.setMaxThreadCount(AVATAR_IMAGE_MAX_THREADS);
+}
+
+QQuickImageResponse *AvatarImageProvider::requestImageResponse(const QString &id, const QSize &requestedSize)
+{
+	return AsyncImageResponse::start(m_threadPool, [=]() {
+		return loadImage(id, requestedSize);
+	}, QStringLiteral("Avatar %1 could not be loaded").arg(id));
+}
+
+QImage AvatarImageProvider::loadImage(const QString &hash, const QSize &requestedSize)
+{
+	// Use the smallest variant which is at least as large as the requested size.
+	const int requestedDimension = std::max(requestedSize.width(), requestedSize.height());
+	const auto variantSize = std::find_if(std::begin(AVATAR_VARIANT_SIZES), std::end(AVATAR_VARIANT_SIZES), [=](int size) {
+		return size >= requestedDimension;
+	});
+	const bool isVariantUsed = requestedDimension > 0 && variantSize != std::end(AVATAR_VARIANT_SIZES);
+
+	const QSize size = isVariantUsed ? QSize(*variantSize, *variantSize) : requestedSize;
+	const QString cacheKey = hash + QLatin1Char('_') + QString::number(size.width()) + QLatin1Char('x') + QString::number(size.height());
+
+	QImage image = m_cache.image(cacheKey);
+	if (!image.isNull())
+		return image;
+
+	if (isVariantUsed) {
+		const auto variantPath = m_avatarStorage->getAvatarVariantPath(hash, *variantSize);
+		image.load(variantPath);
+
+		if (image.isNull()) {
+			image = loadOriginalImage(hash, size);
+
+			if (!image.isNull()) {
+				QSaveFile file(variantPath);
+				if (!(file.open(QIODevice::WriteOnly) && image.save(&file, "PNG") && file.commit()))
+					qWarning() << "[AvatarImageProvider] Could not write" << variantPath << ":" << file.errorString();
+			}
+		}
+	} else {
+		image = loadOriginalImage(hash, size);
+	}
+
+	if (!image.isNull())
+		m_cache.insert(cacheKey, image);
+
+	return image;
+}
+
+QImage AvatarImageProvider::loadOriginalImage(const QString &hash, const QSize &size) const
+{
+	const auto path = m_avatarStorage->getAvatarPath(hash);
+	if (path.isEmpty())
+		return {};
+
+	QImageReader reader(path);
+	reader.setAutoTransform(true);
+
+	// Let the decoder scale the image down (e.g. JPEG images are only partly decoded).
+	if (const auto originalSize = reader.size(); size.isValid() && !size.isEmpty() && originalSize.isValid()) {
+		if (originalSize.width() > size.width() || originalSize.height() > size.height())
+			reader.setScaledSize(originalSize.scaled(size, Qt::KeepAspectRatio));
+	}
+
+	return reader.read();
+}
@@ -0,0 +1,82 @@
+/*
+ *  Kaidan - A user-friendly XMPP client for every device!
+ *
+ *  Copyright (C) 2016-2021 Kaidan developers and contributors
+ *  (see the LICENSE file for a full list of copyright authors)
+ *
+ *  Kaidan is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  In addition, as a special exception, the author of Kaidan gives
+ *  permission to link the code of its release with the OpenSSL
+ *  project's "OpenSSL" library (or with modified versions of it that
+ *  use the same license as the "OpenSSL" library), and distribute the
+ *  linked executables. You must obey the GNU General Public License in
+ *  all respects for all of the code used other than "OpenSSL". If you
+ *  modify this file, you may extend this exception to your version of
+ *  the file, but you are not obligated to do so.  If you do not wish to
+ *  do so, delete this exception statement from your version.
+ *
+ *  Kaidan is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Kaidan.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+// Qt
+#include <QImage>
+#include <QQuickAsyncImageProvider>
+#include <QThreadPool>
+// Kaidan
+#include "ImageCache.h"
+
+class AvatarFileStorage;
+
+/**
+ * Provider for avatars stored by the AvatarFileStorage
+ *
+ * Avatars are requested by their hashes. Requests for small sizes are served by variants
+ * scaled to the next size of AVATAR_VARIANT_SIZES. The variants are stored next to the
+ * original avatars so that the originals are only decoded once. Decoded images are kept
+ * in a memory cache limited by the number of bytes of its images.
+ *
+ * @note This class is thread-safe.
+ */
+class AvatarImageProvider : public QQuickAsyncImageProvider
+{
+public:
+	AvatarImageProvider(AvatarFileStorage *avatarStorage);
+
+	/**
+	 * Starts loading an avatar in the background.
+	 *
+	 * @param id hash of the avatar
+	 * @param requestedSize size the avatar should fit in
+	 */
+	QQuickImageResponse *requestImageResponse(const QString &id, const QSize &requestedSize) override;
+
+	/**
+	 * Loads an avatar from the memory cache, from a stored variant or from the original
+	 * avatar.
+	 *
+	 * @param hash hash of the avatar
+	 * @param requestedSize size the avatar should fit in
+	 *
+	 * @return the avatar or a null image if it could not be loaded
+	 */
+	QImage loadImage(const QString &hash, const QSize &requestedSize);
+
+private:
+	QImage loadOriginalImage(const QString &hash, const QSize &size) const;
+
+	AvatarFileStorage *m_avatarStorage;
+	QThreadPool m_threadPool;
+	ImageCache m_cache;
+};
@@ -31,11 +31,22 @@
 #include "BitsOfBinaryImageProvider.h"
 
 // Qt
+#include <QBuffer>
+#include <QDebug>
 #include <QImageReader>
 #include <QMimeType>
-#include <QMutexLocker>
+#include <QReadLocker>
+#include <QWriteLocker>
 // QXmpp
 #include <QXmppBitsOfBinaryContentId.h>
+// Kaidan
+#include "AsyncImageResponse.h"
+
+// maximum number of bytes of stored data (e.g. CAPTCHAs of registration forms)
+constexpr qint64 BITS_OF_BINARY_MAX_DATA_SIZE = 4 * 1024 * 1024;
+
+// maximum number of bytes of decoded images kept in memory
+constexpr int BITS_OF_BINARY_IMAGE_CACHE_SIZE = 8 * 1024 * 1024;
 
 BitsOfBinaryImageProvider *BitsOfBinaryImageProvider::s_instance;
 
@@ -48,7 +59,7 @@ BitsOfBinaryImageProvider *BitsOfBinaryImageProvider::instance()
 }
 
 BitsOfBinaryImageProvider::BitsOfBinaryImageProvider()
-	: QQuickImageProvider(QQuickImageProvider::Image)
+	: m_imageCache(BITS_OF_BINARY_IMAGE_CACHE_SIZE)
 {
 	Q_ASSERT(!s_instance);
 	s_instance = this;
@@ -56,47 +67,112 @@ BitsOfBinaryImageProvider::BitsOfBinaryImageProvider()
 
 BitsOfBinaryImageProvider::~BitsOfBinaryImageProvider()
 {
+	// Wait for running responses before the data is destroyed.
+	m_threadPool.waitForDone();
 	s_instance = nullptr;
 }
 
-QImage BitsOfBinaryImageProvider::requestImage(const QString &id, QSize *size, const QSize &requestedSize)
+QQuickImageResponse *BitsOfBinaryImageProvider::requestImageResponse(const QString &id, const QSize &requestedSize)
 {
-	QMutexLocker locker(&m_cacheMutex);
+	return AsyncImageResponse::start(m_threadPool, [=]() {
+		return loadImage(id, requestedSize);
+	}, QStringLiteral("No image found for %1").arg(id));
+}
 
-	const auto item = std::find_if(m_cache.begin(), m_cache.end(), [=] (const QXmppBitsOfBinaryData &item) {
-		return item.cid().toCidUrl() == id;
-	});
+QImage BitsOfBinaryImageProvider::loadImage(const QString &id, const QSize &requestedSize)
+{
+	const QString cacheKey = id + QLatin1Char(' ') + QString::number(requestedSize.width()) + QLatin1Char('x') + QString::number(requestedSize.height());
+
+	if (const auto image = m_imageCache.image(cacheKey); !image.isNull())
+		return image;
+
+	QByteArray data;
+	{
+		QReadLocker locker(&m_dataLock);
+		data = m_data.value(id);
+	}
 
-	if (item == m_cache.end())
+	if (data.isEmpty())
 		return {};
 
-	QImage image = QImage::fromData((*item).data());
-	size->setWidth(image.width());
-	size->setHeight(image.height());
+	QBuffer buffer(&data);
+	QImageReader reader(&buffer);
+
+	// Let the decoder scale the image while decoding it.
+	if (requestedSize.isValid() && !requestedSize.isEmpty()) {
+		reader.setScaledSize(requestedSize);
+	} else if (requestedSize.width() > 0 || requestedSize.height() > 0) {
+		// Keep the aspect ratio if only one dimension is requested.
+		const auto size = reader.size();
+		if (size.isValid() && !size.isEmpty())
+			reader.setScaledSize(requestedSize.width() > 0
+				? QSize(requestedSize.width(), size.height() * requestedSize.width() / size.width())
+				: QSize(size.width() * requestedSize.height() / size.height(), requestedSize.height()));
+	}
+
+	QImage image = reader.read();
 
-	if (requestedSize.isValid())
-		image = image.scaled(requestedSize);
+	if (!image.isNull()) {
+		// Do not cache images of data which was removed while decoding.
+		QReadLocker dataLocker(&m_dataLock);
+		if (m_data.contains(id))
+			m_imageCache.insert(cacheKey, image);
+	}
 
 	return image;
 }
 
 bool BitsOfBinaryImageProvider::addImage(const QXmppBitsOfBinaryData &data)
 {
-	QMutexLocker locker(&m_cacheMutex);
-
 	if (!QImageReader::supportedMimeTypes().contains(data.contentType().name().toUtf8())) {
 		return false;
 	}
 
-	m_cache << data;
+	const auto dataSize = data.data().size();
+	if (dataSize > BITS_OF_BINARY_MAX_DATA_SIZE) {
+		qWarning() << "[BitsOfBinaryImageProvider] Ignoring image with" << dataSize << "bytes";
+		return false;
+	}
+
+	const auto cidUrl = data.cid().toCidUrl();
+
+	QWriteLocker locker(&m_dataLock);
+	removeData(cidUrl);
+
+	// Remove the oldest data until the new data fits.
+	while (m_dataSize + dataSize > BITS_OF_BINARY_MAX_DATA_SIZE)
+		removeData(m_cidUrls.first());
+
+	m_data.insert(cidUrl, data.data());
+	m_cidUrls.append(cidUrl);
+	m_dataSize += dataSize;
+
 	return true;
 }
 
 bool BitsOfBinaryImageProvider::removeImage(const QXmppBitsOfBinaryContentId &cid)
 {
-	QMutexLocker locker(&m_cacheMutex);
+	QWriteLocker locker(&m_dataLock);
+	return removeData(cid.toCidUrl());
+}
+
+qint64 BitsOfBinaryImageProvider::dataSize() const
+{
+	QReadLocker locker(&m_dataLock);
+	return m_dataSize;
+}
+
+bool BitsOfBinaryImageProvider::removeData(const QString &cidUrl)
+{
+	const auto itr = m_data.find(cidUrl);
+	if (itr == m_data.end())
+		return false;
 
-	return m_cache.end() != std::remove_if(m_cache.begin(), m_cache.end(), [&] (const QXmppBitsOfBinaryData &item) {
-		return item.cid() == cid;
-	});
+	m_dataSize -= itr->size();
+	m_data.erase(itr);
+	m_cidUrls.removeOne(cidUrl);
+
+	m_imageCache.removeByPrefix(cidUrl + QLatin1Char(' '));
+
+	return true;
 }
@@ -31,18 +31,27 @@
 #pragma once
 
 // Qt
-#include <QQuickImageProvider>
-#include <QMutex>
-#include <QVector>
+#include <QHash>
+#include <QImage>
+#include <QQuickAsyncImageProvider>
+#include <QReadWriteLock>
+#include <QStringList>
+#include <QThreadPool>
 // QXmpp
 #include <QXmppBitsOfBinaryData.h>
+// Kaidan
+#include "ImageCache.h"
 
 /**
  * Provider for images received via XEP-0231: Bits of Binary
  *
+ * The data is stored by its content ID up to a maximum number of bytes. If new data does
+ * not fit anymore, the oldest data is removed. Decoded images are kept in a cache which is
+ * limited by the number of bytes of its images as well.
+ *
  * @note This class is thread-safe.
  */
-class BitsOfBinaryImageProvider : public QQuickImageProvider
+class BitsOfBinaryImageProvider : public QQuickAsyncImageProvider
 {
 public:
 	static BitsOfBinaryImageProvider *instance();
@@ -51,14 +60,24 @@ public:
 	~BitsOfBinaryImageProvider();
 
 	/**
-	 * Creates a QImage from the cached data.
+	 * Starts decoding an image from the cached data in the background.
+	 *
+	 * @param id BitsOfBinary content URL of the requested image (starting with "cid:").
+	 * @param requestedSize size the image should be scaled to. If this is invalid the image
+	 * is not scaled.
+	 */
+	QQuickImageResponse *requestImageResponse(const QString &id, const QSize &requestedSize) override;
+
+	/**
+	 * Creates a QImage from the cached data or returns the already decoded image.
 	 *
 	 * @param id BitsOfBinary content URL of the requested image (starting with "cid:").
-	 * @param size size of the cached image.
 	 * @param requestedSize size the image should be scaled to. If this is invalid the image
 	 * is not scaled.
+	 *
+	 * @return the image or a null image if there is no data for the content URL
 	 */
-	QImage requestImage(const QString &id, QSize *size, const QSize &requestedSize) override;
+	QImage loadImage(const QString &id, const QSize &requestedSize);
 
 	/**
 	 * Adds @c QXmppBitsOfBinaryData to the cache used to provide images to QML.
@@ -80,8 +99,28 @@ public:
 	 */
 	bool removeImage(const QXmppBitsOfBinaryContentId &cid);
 
+	/**
+	 * Returns the number of bytes of the stored data.
+	 */
+	qint64 dataSize() const;
+
 private:
+	/**
+	 * Removes the data of a content URL and its decoded images.
+	 *
+	 * The data lock must be locked for writing.
+	 */
+	bool removeData(const QString &cidUrl);
+
 	static BitsOfBinaryImageProvider *s_instance;
-	QMutex m_cacheMutex;
-	QVector<QXmppBitsOfBinaryData> m_cache;
+
+	mutable QReadWriteLock m_dataLock;
+	QHash<QString, QByteArray> m_data;
+	// content URLs in the order they were added
+	QStringList m_cidUrls;
+	qint64 m_dataSize = 0;
+
+	ImageCache m_imageCache;
+
+	QThreadPool m_threadPool;
 };
@@ -0,0 +1,124 @@
+/*
+ *  Kaidan - A user-friendly XMPP client for every device!
+ *
+ *  Copyright (C) 2016-2021 Kaidan developers and contributors
+ *  (see the LICENSE file for a full list of copyright authors)
+ *
+ *  Kaidan is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  In addition, as a special exception, the author of Kaidan gives
+ *  permission to link the code of its release with the OpenSSL
+ *  project's "OpenSSL" library (or with modified versions of it that
+ *  use the same license as the "OpenSSL" library), and distribute the
+ *  linked executables. You must obey the GNU General Public License in
+ *  all respects for all of the code used other than "OpenSSL". If you
+ *  modify this file, you may extend this exception to your version of
+ *  the file, but you are not obligated to do so.  If you do not wish to
+ *  do so, delete this exception statement from your version.
+ *
+ *  Kaidan is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Kaidan.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ChatStateCoalescer.h"
+
+#include <chrono>
+
+// Qt
+#include <QTimer>
+// Kaidan
+#include "PresenceCache.h"
+
+using namespace std::chrono_literals;
+
+// Time in which chat state changes are collected before they are sent
+constexpr auto CHAT_STATE_COALESCING_INTERVAL = 300ms;
+
+ChatStateCoalescer::ChatStateCoalescer(QObject *parent)
+	: QObject(parent),
+	  m_flushTimer(new QTimer(this))
+{
+	m_flushTimer->setSingleShot(true);
+	m_flushTimer->setInterval(CHAT_STATE_COALESCING_INTERVAL);
+	m_flushTimer->callOnTimeout(this, &ChatStateCoalescer::flush);
+}
+
+ChatStateCoalescer::~ChatStateCoalescer() = default;
+
+void ChatStateCoalescer::setChatState(const QString &bareJid, QXmppMessage::State state)
+{
+	if (bareJid.isEmpty())
+		return;
+
+	if (m_pendingStates.contains(bareJid))
+		m_coalescedStateCount++;
+
+	m_pendingStates.insert(bareJid, state);
+
+	if (!m_flushTimer->isActive())
+		m_flushTimer->start();
+}
+
+void ChatStateCoalescer::flush()
+{
+	m_flushTimer->stop();
+
+	if (m_pendingStates.isEmpty())
+		return;
+
+	ChatStates states;
+
+	for (auto itr = m_pendingStates.cbegin(); itr != m_pendingStates.cend(); ++itr) {
+		const auto &bareJid = itr.key();
+		const auto state = itr.value();
+
+		// Chat states are only sent to available chat partners. The state seen by a
+		// chat partner is reset as soon as it goes offline.
+		if (PresenceCache::instance()->resources(bareJid).isEmpty()) {
+			m_sentStates.remove(bareJid);
+			m_suppressedStateCount++;
+			continue;
+		}
+
+		// A chat partner who has not received any state treats the user as gone.
+		const auto lastState = m_sentStates.value(bareJid, QXmppMessage::Gone);
+		if (state == lastState || (state == QXmppMessage::None && lastState == QXmppMessage::Gone)) {
+			m_coalescedStateCount++;
+			continue;
+		}
+
+		m_sentStates.insert(bareJid, state);
+		states.insert(bareJid, state);
+	}
+
+	m_pendingStates.clear();
+
+	if (states.isEmpty())
+		return;
+
+	m_sentStateCount += states.size();
+	emit sendChatStatesRequested(states);
+}
+
+uint ChatStateCoalescer::sentStates() const
+{
+	return m_sentStateCount;
+}
+
+uint ChatStateCoalescer::coalescedStates() const
+{
+	return m_coalescedStateCount;
+}
+
+uint ChatStateCoalescer::suppressedStates() const
+{
+	return m_suppressedStateCount;
+}
@@ -0,0 +1,112 @@
+/*
+ *  Kaidan - A user-friendly XMPP client for every device!
+ *
+ *  Copyright (C) 2016-2021 Kaidan developers and contributors
+ *  (see the LICENSE file for a full list of copyright authors)
+ *
+ *  Kaidan is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  In addition, as a special exception, the author of Kaidan gives
+ *  permission to link the code of its release with the OpenSSL
+ *  project's "OpenSSL" library (or with modified versions of it that
+ *  use the same license as the "OpenSSL" library), and distribute the
+ *  linked executables. You must obey the GNU General Public License in
+ *  all respects for all of the code used other than "OpenSSL". If you
+ *  modify this file, you may extend this exception to your version of
+ *  the file, but you are not obligated to do so.  If you do not wish to
+ *  do so, delete this exception statement from your version.
+ *
+ *  Kaidan is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Kaidan.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+// Qt
+#include <QHash>
+#include <QObject>
+// QXmpp
+#include <QXmppMessage.h>
+
+class QTimer;
+
+/**
+ * Chat states mapped to the bare JIDs of the chat partners they are sent to
+ */
+using ChatStates = QHash<QString, QXmppMessage::State>;
+
+Q_DECLARE_METATYPE(ChatStates)
+
+/**
+ * @class ChatStateCoalescer Collects the user's chat state changes (XEP-0085) and sends
+ * them in batches.
+ *
+ * Each change is kept for a short time so that only the latest state per chat partner is
+ * sent. States not changing what the chat partner saw last and states to chat partners
+ * being offline are not sent at all. That way, switching quickly between chats does not
+ * result in a burst of stanzas.
+ */
+class ChatStateCoalescer : public QObject
+{
+	Q_OBJECT
+
+public:
+	explicit ChatStateCoalescer(QObject *parent = nullptr);
+	~ChatStateCoalescer();
+
+	/**
+	 * Enqueues a chat state to be sent.
+	 *
+	 * A state replaces an enqueued state for the same chat partner.
+	 *
+	 * @param bareJid bare JID of the chat partner
+	 * @param state new chat state
+	 */
+	void setChatState(const QString &bareJid, QXmppMessage::State state);
+
+	/**
+	 * Sends all enqueued chat states.
+	 */
+	void flush();
+
+	/**
+	 * Returns the number of chat states sent so far.
+	 */
+	uint sentStates() const;
+
+	/**
+	 * Returns the number of chat states not sent because they were replaced by a newer
+	 * state or did not change the state last sent.
+	 */
+	uint coalescedStates() const;
+
+	/**
+	 * Returns the number of chat states not sent because the chat partner was offline.
+	 */
+	uint suppressedStates() const;
+
+signals:
+	/**
+	 * Emitted to send a batch of chat states.
+	 *
+	 * @param states chat states mapped to the bare JIDs of the chat partners
+	 */
+	void sendChatStatesRequested(const ChatStates &states);
+
+private:
+	QTimer *m_flushTimer;
+	ChatStates m_pendingStates;
+	ChatStates m_sentStates;
+
+	uint m_sentStateCount = 0;
+	uint m_coalescedStateCount = 0;
+	uint m_suppressedStateCount = 0;
+};
@@ -52,6 +52,7 @@
 #include "RosterManager.h"
 #include "RosterModel.h"
 #include "ServerFeaturesCache.h"
+#include "StreamTracker.h"
 #include "TransferCache.h"
 #include "UploadManager.h"
 #include "VCardCache.h"
@@ -83,11 +84,12 @@ ClientWorker::ClientWorker(Caches *caches, bool enableLogging, QObject* parent)
 	  m_client(new QXmppClient(this)),
 	  m_logger(new LogHandler(m_client, enableLogging, this)),
 	  m_enableLogging(enableLogging),
+	  m_streamTracker(new StreamTracker(m_client, this)),
 	  m_registrationManager(new RegistrationManager(this, m_client, this)),
 	  m_vCardManager(new VCardManager(this, m_client, m_caches->avatarStorage, this)),
-	  m_rosterManager(new RosterManager(m_client, m_caches->avatarStorage, m_vCardManager, this)),
+	  m_rosterManager(new RosterManager(m_client, m_streamTracker, m_caches->avatarStorage, m_vCardManager, this)),
 	  m_messageHandler(new MessageHandler(this, m_client, this)),
-	  m_discoveryManager(new DiscoveryManager(m_client, this)),
+	  m_discoveryManager(new DiscoveryManager(m_client, m_streamTracker, this)),
 	  m_uploadManager(new UploadManager(m_client, m_rosterManager, this)),
 	  m_downloadManager(new DownloadManager(caches->transferCache, this)),
 	  m_versionManager(new VersionManager(m_client, this))
@@ -104,7 +106,11 @@ ClientWorker::ClientWorker(Caches *caches, bool enableLogging, QObject* parent)
 
 	// presence
 	connect(m_client, &QXmppClient::presenceReceived, caches->presCache, &PresenceCache::updatePresence);
-	connect(m_client, &QXmppClient::disconnected, caches->presCache, &PresenceCache::clear);
+
+	// carbons discovery
+	connect(m_discoveryManager, &DiscoveryManager::infoReceived, m_messageHandler, &MessageHandler::handleDiscoInfo);
+	// upload service discovery
+	connect(m_discoveryManager, &DiscoveryManager::infoReceived, m_uploadManager, &UploadManager::handleDiscoInfo);
 
 	// Reduce the network traffic when the application window is not active.
 	connect(qGuiApp, &QGuiApplication::applicationStateChanged, [=](Qt::ApplicationState state) {
@@ -317,11 +323,36 @@ void ClientWorker::onConnected()
 	// automatically in case of a connection outage.
 	m_client->configuration().setAutoReconnectionEnabled(true);
 
-	MessageModel::instance()->sendPendingMessages();
+	const bool isStreamResumed = m_streamTracker->isStreamResumed();
+
+	// The presences of the previous stream are only valid if it was resumed.
+	if (!isStreamResumed)
+		QMetaObject::invokeMethod(m_caches->presCache, &PresenceCache::clear);
+
+	if (m_reconnectionTimer.isValid()) {
+		if (isStreamResumed)
+			m_resumedReconnections++;
+		else
+			m_fullReconnections++;
+
+		qDebug() << "[client] Reconnected after" << m_reconnectionTimer.elapsed() << "ms"
+		         << "(stream resumed:" << isStreamResumed << "| resumed reconnections:" << m_resumedReconnections
+		         << "| full reconnections:" << m_fullReconnections << ")";
+		m_reconnectionTimer.invalidate();
+	}
+
+	m_messageHandler->sendPendingMessages();
 }
 
 void ClientWorker::onDisconnected()
 {
+	// Keep the presences while the client tries to resume the stream. They are cleared
+	// after connecting if the stream could not be resumed.
+	if (m_client->configuration().autoReconnectionEnabled() && m_streamTracker->isResumptionPossible())
+		m_reconnectionTimer.start();
+	else
+		QMetaObject::invokeMethod(m_caches->presCache, &PresenceCache::clear);
+
 	if (m_isReconnecting) {
 		m_isReconnecting = false;
 		connectToServer(m_configToBeUsedOnNextConnect);
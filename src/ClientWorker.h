@@ -31,6 +31,7 @@
 #pragma once
 
 // Qt
+#include <QElapsedTimer>
 // QXmpp
 #include <QXmppClient.h>
 // Kaidan
@@ -48,6 +49,7 @@ class RegistrationManager;
 class RosterManager;
 class RosterModel;
 class ServerFeaturesCache;
+class StreamTracker;
 class TransferCache;
 class UploadManager;
 class VCardCache;
@@ -152,6 +154,11 @@ public:
 		return m_versionManager;
 	}
 
+	StreamTracker *streamTracker() const
+	{
+		return m_streamTracker;
+	}
+
 	Caches *caches() const
 	{
 		return m_caches;
@@ -299,6 +306,8 @@ private:
 	LogHandler *m_logger;
 	bool m_enableLogging;
 
+	// This must be constructed before the managers using it.
+	StreamTracker *const m_streamTracker;
 	RegistrationManager *const m_registrationManager;
 	VCardManager *const m_vCardManager;
 	RosterManager *const m_rosterManager;
@@ -316,6 +325,11 @@ private:
 	bool m_isDisconnecting = false;
 	QXmppConfiguration m_configToBeUsedOnNextConnect;
 
+	// These variables are used for measuring the duration of automatic reconnections.
+	QElapsedTimer m_reconnectionTimer;
+	uint m_resumedReconnections = 0;
+	uint m_fullReconnections = 0;
+
 	// These variables are used for checking the state of an ongoing account deletion.
 	bool m_isAccountToBeDeletedFromClient = false;
 	bool m_isAccountToBeDeletedFromClientAndServer = false;
@@ -52,8 +52,8 @@
 	}
 
 // Both need to be updated on version bump:
-#define DATABASE_LATEST_VERSION 13
-#define DATABASE_CONVERT_TO_LATEST_VERSION() DATABASE_CONVERT_TO_VERSION(13)
+#define DATABASE_LATEST_VERSION 18
+#define DATABASE_CONVERT_TO_LATEST_VERSION() DATABASE_CONVERT_TO_VERSION(18)
 
 #define SQL_BOOL "BOOL"
 #define SQL_INTEGER "INTEGER"
@@ -205,6 +205,11 @@ void Database::createNewDatabase()
 	createDbInfoTable();
 	createRosterTable();
 	createMessagesTable();
+	createPendingMessagesIndex();
+	createMamSyncStateTable();
+	createDiscoTables();
+	createVCardsTable();
+	createRosterVersionsTable();
 
 	m_version = DATABASE_LATEST_VERSION;
 }
@@ -295,6 +300,83 @@ void Database::createMessagesTable()
 	);
 }
 
+void Database::createPendingMessagesIndex()
+{
+	QSqlQuery query(m_database);
+	Utils::execQuery(
+		query,
+		"CREATE INDEX pendingMessagesIndex ON " DB_TABLE_MESSAGES " (author, deliveryState)"
+	);
+}
+
+void Database::createMamSyncStateTable()
+{
+	QSqlQuery query(m_database);
+	Utils::execQuery(
+		query,
+		SQL_CREATE_TABLE(
+			DB_TABLE_MAM_SYNC_STATE,
+			SQL_ATTRIBUTE(accountJid, SQL_TEXT_NOT_NULL)
+			SQL_ATTRIBUTE(lastStanzaId, SQL_TEXT)
+			"PRIMARY KEY(accountJid)"
+		)
+	);
+}
+
+void Database::createDiscoTables()
+{
+	QSqlQuery query(m_database);
+	Utils::execQuery(
+		query,
+		SQL_CREATE_TABLE(
+			DB_TABLE_DISCO_INFOS,
+			SQL_ATTRIBUTE(verificationString, SQL_TEXT_NOT_NULL)
+			SQL_ATTRIBUTE(info, SQL_TEXT_NOT_NULL)
+			"PRIMARY KEY(verificationString)"
+		)
+	);
+	Utils::execQuery(
+		query,
+		SQL_CREATE_TABLE(
+			DB_TABLE_DISCO_ENTITIES,
+			SQL_ATTRIBUTE(jid, SQL_TEXT_NOT_NULL)
+			SQL_ATTRIBUTE(serverJid, SQL_TEXT_NOT_NULL)
+			SQL_ATTRIBUTE(verificationString, SQL_TEXT_NOT_NULL)
+			SQL_ATTRIBUTE(timestamp, SQL_TEXT_NOT_NULL)
+			"PRIMARY KEY(jid)"
+		)
+	);
+}
+
+void Database::createVCardsTable()
+{
+	QSqlQuery query(m_database);
+	Utils::execQuery(
+		query,
+		SQL_CREATE_TABLE(
+			DB_TABLE_VCARDS,
+			SQL_ATTRIBUTE(jid, SQL_TEXT_NOT_NULL)
+			SQL_ATTRIBUTE(photoHash, SQL_TEXT)
+			SQL_ATTRIBUTE(vCard, SQL_TEXT_NOT_NULL)
+			"PRIMARY KEY(jid)"
+		)
+	);
+}
+
+void Database::createRosterVersionsTable()
+{
+	QSqlQuery query(m_database);
+	Utils::execQuery(
+		query,
+		SQL_CREATE_TABLE(
+			DB_TABLE_ROSTER_VERSIONS,
+			SQL_ATTRIBUTE(accountJid, SQL_TEXT_NOT_NULL)
+			SQL_ATTRIBUTE(version, SQL_TEXT_NOT_NULL)
+			"PRIMARY KEY(accountJid)"
+		)
+	);
+}
+
 void Database::convertDatabaseToV2()
 {
 	// create a new dbinfo table
@@ -431,3 +513,38 @@ void Database::convertDatabaseToV13()
 	Utils::execQuery(query, "ALTER TABLE Messages ADD originId " SQL_TEXT);
 	m_version = 13;
 }
+
+void Database::convertDatabaseToV14()
+{
+	DATABASE_CONVERT_TO_VERSION(13);
+	createMamSyncStateTable();
+	m_version = 14;
+}
+
+void Database::convertDatabaseToV15()
+{
+	DATABASE_CONVERT_TO_VERSION(14);
+	createPendingMessagesIndex();
+	m_version = 15;
+}
+
+void Database::convertDatabaseToV16()
+{
+	DATABASE_CONVERT_TO_VERSION(15);
+	createDiscoTables();
+	m_version = 16;
+}
+
+void Database::convertDatabaseToV17()
+{
+	DATABASE_CONVERT_TO_VERSION(16);
+	createVCardsTable();
+	m_version = 17;
+}
+
+void Database::convertDatabaseToV18()
+{
+	DATABASE_CONVERT_TO_VERSION(17);
+	createRosterVersionsTable();
+	m_version = 18;
+}
@@ -98,6 +98,11 @@ private:
 	void createDbInfoTable();
 	void createRosterTable();
 	void createMessagesTable();
+	void createPendingMessagesIndex();
+	void createMamSyncStateTable();
+	void createDiscoTables();
+	void createVCardsTable();
+	void createRosterVersionsTable();
 
 	/**
 	 * Creates a new database without content.
@@ -119,6 +124,11 @@ private:
 	void convertDatabaseToV11();
 	void convertDatabaseToV12();
 	void convertDatabaseToV13();
+	void convertDatabaseToV14();
+	void convertDatabaseToV15();
+	void convertDatabaseToV16();
+	void convertDatabaseToV17();
+	void convertDatabaseToV18();
 
 	QSqlDatabase m_database;
 
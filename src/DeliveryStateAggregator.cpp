@@ -0,0 +1,96 @@
+/*
+ *  Kaidan - A user-friendly XMPP client for every device!
+ *
+ *  Copyright (C) 2016-2021 Kaidan developers and contributors
+ *  (see the LICENSE file for a full list of copyright authors)
+ *
+ *  Kaidan is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  In addition, as a special exception, the author of Kaidan gives
+ *  permission to link the code of its release with the OpenSSL
+ *  project's "OpenSSL" library (or with modified versions of it that
+ *  use the same license as the "OpenSSL" library), and distribute the
+ *  linked executables. You must obey the GNU General Public License in
+ *  all respects for all of the code used other than "OpenSSL". If you
+ *  modify this file, you may extend this exception to your version of
+ *  the file, but you are not obligated to do so.  If you do not wish to
+ *  do so, delete this exception statement from your version.
+ *
+ *  Kaidan is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Kaidan.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "DeliveryStateAggregator.h"
+
+#include <chrono>
+
+// Qt
+#include <QTimer>
+
+using namespace std::chrono_literals;
+
+// Time in which delivery state changes are collected before they are applied
+constexpr auto DELIVERY_STATE_AGGREGATION_INTERVAL = 150ms;
+
+// Number of collected delivery state changes after which they are applied immediately
+constexpr int DELIVERY_STATE_AGGREGATION_MAX_COUNT = 500;
+
+DeliveryStateAggregator *DeliveryStateAggregator::s_instance = nullptr;
+
+DeliveryStateAggregator::DeliveryStateAggregator(QObject *parent)
+	: QObject(parent),
+	  m_flushTimer(new QTimer(this))
+{
+	Q_ASSERT(!s_instance);
+	s_instance = this;
+
+	m_flushTimer->setSingleShot(true);
+	m_flushTimer->setInterval(DELIVERY_STATE_AGGREGATION_INTERVAL);
+	m_flushTimer->callOnTimeout(this, &DeliveryStateAggregator::flush);
+}
+
+DeliveryStateAggregator::~DeliveryStateAggregator()
+{
+	s_instance = nullptr;
+}
+
+DeliveryStateAggregator *DeliveryStateAggregator::instance()
+{
+	return s_instance;
+}
+
+void DeliveryStateAggregator::setDeliveryState(const QString &id, Enums::DeliveryState deliveryState, const QString &errorText)
+{
+	if (const auto itr = m_updates.constFind(id);
+		itr != m_updates.cend() &&
+		itr->deliveryState == Enums::DeliveryState::Delivered &&
+		deliveryState == Enums::DeliveryState::Sent) {
+		return;
+	}
+
+	m_updates.insert(id, { deliveryState, errorText });
+
+	if (m_updates.size() >= DELIVERY_STATE_AGGREGATION_MAX_COUNT)
+		flush();
+	else if (!m_flushTimer->isActive())
+		m_flushTimer->start();
+}
+
+void DeliveryStateAggregator::flush()
+{
+	m_flushTimer->stop();
+
+	if (m_updates.isEmpty())
+		return;
+
+	emit deliveryStatesChanged(m_updates);
+	m_updates.clear();
+}
@@ -0,0 +1,89 @@
+/*
+ *  Kaidan - A user-friendly XMPP client for every device!
+ *
+ *  Copyright (C) 2016-2021 Kaidan developers and contributors
+ *  (see the LICENSE file for a full list of copyright authors)
+ *
+ *  Kaidan is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  In addition, as a special exception, the author of Kaidan gives
+ *  permission to link the code of its release with the OpenSSL
+ *  project's "OpenSSL" library (or with modified versions of it that
+ *  use the same license as the "OpenSSL" library), and distribute the
+ *  linked executables. You must obey the GNU General Public License in
+ *  all respects for all of the code used other than "OpenSSL". If you
+ *  modify this file, you may extend this exception to your version of
+ *  the file, but you are not obligated to do so.  If you do not wish to
+ *  do so, delete this exception statement from your version.
+ *
+ *  Kaidan is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Kaidan.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+// Qt
+#include <QObject>
+// Kaidan
+#include "Message.h"
+
+class QTimer;
+
+/**
+ * @class DeliveryStateAggregator Collects delivery state changes of messages (e.g. by
+ * delivery receipts) and applies them in batches.
+ *
+ * Each change is kept for a short time so that a burst of changes (e.g. after a
+ * reconnection) results in only one update of the message model and one database
+ * query.
+ */
+class DeliveryStateAggregator : public QObject
+{
+	Q_OBJECT
+
+public:
+	explicit DeliveryStateAggregator(QObject *parent = nullptr);
+	~DeliveryStateAggregator();
+
+	static DeliveryStateAggregator *instance();
+
+	/**
+	 * Enqueues a change of a message's delivery state.
+	 *
+	 * A change replaces an enqueued change of the same message. Only a "Sent" state
+	 * does not replace an enqueued "Delivered" state since a delivery receipt can
+	 * arrive before sending the message is confirmed.
+	 *
+	 * @param id ID of the message
+	 * @param deliveryState new delivery state of the message
+	 * @param errorText new error text of the message
+	 */
+	void setDeliveryState(const QString &id, Enums::DeliveryState deliveryState, const QString &errorText = {});
+
+	/**
+	 * Applies all enqueued changes.
+	 */
+	void flush();
+
+signals:
+	/**
+	 * Emitted when enqueued changes are applied.
+	 *
+	 * @param updates changes of the messages' delivery states by their IDs
+	 */
+	void deliveryStatesChanged(const DeliveryStateUpdates &updates);
+
+private:
+	QTimer *m_flushTimer;
+	DeliveryStateUpdates m_updates;
+
+	static DeliveryStateAggregator *s_instance;
+};
@@ -0,0 +1,149 @@
+/*
+ *  Kaidan - A user-friendly XMPP client for every device!
+ *
+ *  Copyright (C) 2016-2021 Kaidan developers and contributors
+ *  (see the LICENSE file for a full list of copyright authors)
+ *
+ *  Kaidan is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  In addition, as a special exception, the author of Kaidan gives
+ *  permission to link the code of its release with the OpenSSL
+ *  project's "OpenSSL" library (or with modified versions of it that
+ *  use the same license as the "OpenSSL" library), and distribute the
+ *  linked executables. You must obey the GNU General Public License in
+ *  all respects for all of the code used other than "OpenSSL". If you
+ *  modify this file, you may extend this exception to your version of
+ *  the file, but you are not obligated to do so.  If you do not wish to
+ *  do so, delete this exception statement from your version.
+ *
+ *  Kaidan is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Kaidan.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "DiscoveryDb.h"
+// Qt
+#include <QDomDocument>
+#include <QSqlQuery>
+#include <QXmlStreamWriter>
+// Kaidan
+#include "Database.h"
+#include "Globals.h"
+#include "Utils.h"
+
+DiscoveryDb *DiscoveryDb::s_instance = nullptr;
+
+DiscoveryDb::DiscoveryDb(Database *db, QObject *parent)
+	: QObject(parent),
+	  m_db(db)
+{
+	Q_ASSERT(!DiscoveryDb::s_instance);
+	s_instance = this;
+
+	connect(this, &DiscoveryDb::fetchDiscoInfosRequested, this, &DiscoveryDb::fetchDiscoInfos);
+	connect(this, &DiscoveryDb::addDiscoInfoRequested, this, &DiscoveryDb::addDiscoInfo);
+	connect(this, &DiscoveryDb::removeDiscoInfosRequested, this, &DiscoveryDb::removeDiscoInfos);
+}
+
+DiscoveryDb::~DiscoveryDb()
+{
+	s_instance = nullptr;
+}
+
+DiscoveryDb *DiscoveryDb::instance()
+{
+	return s_instance;
+}
+
+void DiscoveryDb::fetchDiscoInfos(const QString &serverJid)
+{
+	QSqlQuery query(QSqlDatabase::database(DB_CONNECTION));
+	query.setForwardOnly(true);
+	Utils::execQuery(
+		query,
+		"SELECT entities.jid, infos.info, entities.timestamp FROM " DB_TABLE_DISCO_ENTITIES " entities "
+		"JOIN " DB_TABLE_DISCO_INFOS " infos ON entities.verificationString = infos.verificationString "
+		"WHERE entities.serverJid = ?",
+		QVector<QVariant>() << serverJid
+	);
+
+	QVector<QXmppDiscoveryIq> infos;
+	QDateTime timestamp;
+
+	while (query.next()) {
+		QDomDocument document;
+		if (!document.setContent(query.value(1).toString(), true))
+			continue;
+
+		QXmppDiscoveryIq info;
+		info.parse(document.documentElement());
+		info.setFrom(query.value(0).toString());
+		infos << info;
+
+		const auto infoTimestamp = QDateTime::fromString(query.value(2).toString(), Qt::ISODate);
+		if (timestamp.isNull() || infoTimestamp < timestamp)
+			timestamp = infoTimestamp;
+	}
+
+	emit discoInfosFetched(serverJid, infos, timestamp);
+}
+
+void DiscoveryDb::addDiscoInfo(const QString &serverJid, const QXmppDiscoveryIq &info)
+{
+	const auto verificationString = QString::fromLatin1(info.verificationString().toBase64());
+
+	// The information is stored without the addressing attributes to be independent of
+	// the entity.
+	QXmppDiscoveryIq storedInfo = info;
+	storedInfo.setFrom({});
+	storedInfo.setTo({});
+	storedInfo.setId({});
+
+	QString serializedInfo;
+	QXmlStreamWriter writer(&serializedInfo);
+	storedInfo.toXml(&writer);
+
+	m_db->transaction();
+
+	QSqlQuery query(QSqlDatabase::database(DB_CONNECTION));
+	Utils::execQuery(
+		query,
+		"INSERT OR IGNORE INTO " DB_TABLE_DISCO_INFOS " (verificationString, info) VALUES (?, ?)",
+		QVector<QVariant>() << verificationString << serializedInfo
+	);
+	Utils::execQuery(
+		query,
+		"INSERT OR REPLACE INTO " DB_TABLE_DISCO_ENTITIES " (jid, serverJid, verificationString, timestamp) VALUES (?, ?, ?, ?)",
+		QVector<QVariant>() << info.from() << serverJid << verificationString << QDateTime::currentDateTimeUtc().toString(Qt::ISODate)
+	);
+
+	m_db->commit();
+}
+
+void DiscoveryDb::removeDiscoInfos(const QString &serverJid)
+{
+	m_db->transaction();
+
+	QSqlQuery query(QSqlDatabase::database(DB_CONNECTION));
+	Utils::execQuery(
+		query,
+		"DELETE FROM " DB_TABLE_DISCO_ENTITIES " WHERE serverJid = ?",
+		QVector<QVariant>() << serverJid
+	);
+
+	// remove the information no entity refers to anymore
+	Utils::execQuery(
+		query,
+		"DELETE FROM " DB_TABLE_DISCO_INFOS " WHERE verificationString NOT IN "
+		"(SELECT verificationString FROM " DB_TABLE_DISCO_ENTITIES ")"
+	);
+
+	m_db->commit();
+}
@@ -0,0 +1,101 @@
+/*
+ *  Kaidan - A user-friendly XMPP client for every device!
+ *
+ *  Copyright (C) 2016-2021 Kaidan developers and contributors
+ *  (see the LICENSE file for a full list of copyright authors)
+ *
+ *  Kaidan is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  In addition, as a special exception, the author of Kaidan gives
+ *  permission to link the code of its release with the OpenSSL
+ *  project's "OpenSSL" library (or with modified versions of it that
+ *  use the same license as the "OpenSSL" library), and distribute the
+ *  linked executables. You must obey the GNU General Public License in
+ *  all respects for all of the code used other than "OpenSSL". If you
+ *  modify this file, you may extend this exception to your version of
+ *  the file, but you are not obligated to do so.  If you do not wish to
+ *  do so, delete this exception statement from your version.
+ *
+ *  Kaidan is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Kaidan.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+// Qt
+#include <QDateTime>
+#include <QObject>
+#include <QVector>
+// QXmpp
+#include <QXmppDiscoveryIq.h>
+
+class Database;
+
+/**
+ * @class DiscoveryDb The DiscoveryDb stores the service discovery information (XEP-0030)
+ * of a server and its items.
+ *
+ * Each information is stored once per verification string (XEP-0115) and shared by all
+ * entities having the same information.
+ */
+class DiscoveryDb : public QObject
+{
+	Q_OBJECT
+
+public:
+	DiscoveryDb(Database *db, QObject *parent = nullptr);
+	~DiscoveryDb();
+
+	static DiscoveryDb *instance();
+
+signals:
+	void fetchDiscoInfosRequested(const QString &serverJid);
+
+	/**
+	 * Emitted when the stored information of a server and its items was fetched.
+	 *
+	 * @param serverJid JID of the server
+	 * @param infos information of the server and its items with their JIDs as senders
+	 * @param timestamp time at which the oldest of the information was stored
+	 */
+	void discoInfosFetched(const QString &serverJid, const QVector<QXmppDiscoveryIq> &infos, const QDateTime &timestamp);
+
+	void addDiscoInfoRequested(const QString &serverJid, const QXmppDiscoveryIq &info);
+	void removeDiscoInfosRequested(const QString &serverJid);
+
+public slots:
+	/**
+	 * Fetches the stored information of a server and its items.
+	 *
+	 * @param serverJid JID of the server
+	 */
+	void fetchDiscoInfos(const QString &serverJid);
+
+	/**
+	 * Stores the information of a server or one of its items.
+	 *
+	 * @param serverJid JID of the server
+	 * @param info information with the JID of the server or the item as its sender
+	 */
+	void addDiscoInfo(const QString &serverJid, const QXmppDiscoveryIq &info);
+
+	/**
+	 * Removes the stored information of a server and its items.
+	 *
+	 * @param serverJid JID of the server
+	 */
+	void removeDiscoInfos(const QString &serverJid);
+
+private:
+	Database *m_db;
+
+	static DiscoveryDb *s_instance;
+};
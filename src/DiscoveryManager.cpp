@@ -32,9 +32,15 @@
 // QXmpp
 #include <QXmppDiscoveryManager.h>
 #include <QXmppDiscoveryIq.h>
+// Kaidan
+#include "DiscoveryDb.h"
+#include "StreamTracker.h"
 
-DiscoveryManager::DiscoveryManager(QXmppClient *client, QObject *parent)
-	: QObject(parent), m_client(client), m_manager(client->findExtension<QXmppDiscoveryManager>())
+// number of days after which the stored information is requested again in the background
+constexpr auto STORED_INFOS_MAX_AGE_DAYS = 1;
+
+DiscoveryManager::DiscoveryManager(QXmppClient *client, StreamTracker *streamTracker, QObject *parent)
+	: QObject(parent), m_client(client), m_streamTracker(streamTracker), m_manager(client->findExtension<QXmppDiscoveryManager>())
 {
 	// we're a normal client (not a server, gateway, server component, etc.)
 	m_manager->setClientCategory("client");
@@ -52,6 +58,26 @@ DiscoveryManager::DiscoveryManager(QXmppClient *client, QObject *parent)
 #endif
 
 	connect(client, &QXmppClient::connected, this, &DiscoveryManager::handleConnection);
+	connect(client, &QXmppClient::stateChanged, this, [this](QXmppClient::State state) {
+		// Load the stored information while connecting so that it is available as soon
+		// as the client is connected.
+		if (state != QXmppClient::ConnectingState)
+			return;
+
+		if (const auto serverJid = m_client->configuration().domain(); serverJid != m_serverJid) {
+			m_serverJid = serverJid;
+			m_storedInfos.clear();
+			m_isStoredInfosLoaded = false;
+			m_isStoredInfosLoading = false;
+		}
+
+		if (!m_isStoredInfosLoaded && !m_isStoredInfosLoading) {
+			m_isStoredInfosLoading = true;
+			emit DiscoveryDb::instance()->fetchDiscoInfosRequested(m_serverJid);
+		}
+	});
+	connect(DiscoveryDb::instance(), &DiscoveryDb::discoInfosFetched,
+	        this, &DiscoveryManager::handleStoredInfosFetched);
 	connect(m_manager, &QXmppDiscoveryManager::infoReceived,
 	        this, &DiscoveryManager::handleInfo);
 	connect(m_manager, &QXmppDiscoveryManager::itemsReceived,
@@ -64,14 +90,39 @@ DiscoveryManager::~DiscoveryManager()
 
 void DiscoveryManager::handleConnection()
 {
-	// request disco info & items from the server
-	m_manager->requestInfo(m_client->configuration().domain());
-	m_manager->requestItems(m_client->configuration().domain());
+	// Wait for the stored information if it is not loaded yet.
+	if (!m_isStoredInfosLoaded) {
+		m_isConnectionPending = true;
+
+		if (!m_isStoredInfosLoading) {
+			m_serverJid = m_client->configuration().domain();
+			m_isStoredInfosLoading = true;
+			emit DiscoveryDb::instance()->fetchDiscoInfosRequested(m_serverJid);
+		}
+		return;
+	}
+
+	useStoredInfos();
 }
 
-void DiscoveryManager::handleInfo(const QXmppDiscoveryIq&)
+void DiscoveryManager::handleInfo(const QXmppDiscoveryIq &iq)
 {
-	// TODO: enable carbons and discovery http file upload
+	emit infoReceived(iq);
+
+	if (!m_requestedJids.contains(iq.from()))
+		return;
+
+	m_requestedJids.remove(iq.from());
+
+	const auto itr = std::find_if(m_storedInfos.begin(), m_storedInfos.end(), [&iq](const QXmppDiscoveryIq &info) {
+		return info.from() == iq.from();
+	});
+	if (itr == m_storedInfos.end())
+		m_storedInfos.append(iq);
+	else
+		*itr = iq;
+
+	emit DiscoveryDb::instance()->addDiscoInfoRequested(m_serverJid, iq);
 }
 
 void DiscoveryManager::handleItems(const QXmppDiscoveryIq &iq)
@@ -81,6 +132,67 @@ void DiscoveryManager::handleItems(const QXmppDiscoveryIq &iq)
 	for (const QXmppDiscoveryIq::Item &item : items) {
 		if (item.jid() == m_client->configuration().domain())
 			continue;
+		m_requestedJids.insert(item.jid());
 		m_manager->requestInfo(item.jid());
 	}
 }
+
+void DiscoveryManager::handleStoredInfosFetched(const QString &serverJid, const QVector<QXmppDiscoveryIq> &infos, const QDateTime &timestamp)
+{
+	if (serverJid != m_serverJid)
+		return;
+
+	m_storedInfos = infos;
+	m_storedInfosTimestamp = timestamp;
+	m_isStoredInfosLoaded = true;
+	m_isStoredInfosLoading = false;
+
+	if (m_isConnectionPending) {
+		m_isConnectionPending = false;
+
+		if (m_client->isConnected())
+			useStoredInfos();
+	}
+}
+
+void DiscoveryManager::useStoredInfos()
+{
+	// The stored information is passed to all components (e.g. to the upload manager and
+	// the message handler) as if it was received.
+	for (const auto &info : std::as_const(m_storedInfos))
+		emit infoReceived(info);
+
+	// The server's features stay the same after resuming the stream.
+	if (m_streamTracker->isStreamResumed() && !m_storedInfos.isEmpty())
+		return;
+
+	const auto serverInfoItr = std::find_if(m_storedInfos.cbegin(), m_storedInfos.cend(), [this](const QXmppDiscoveryIq &info) {
+		return info.from() == m_serverJid;
+	});
+
+	const auto serverVerificationString = m_streamTracker->serverVerificationString();
+
+	// The information of the server's items (e.g. the maximum file size of the upload
+	// service) can change without changing the server's verification string. Thus, it is
+	// requested again once it is outdated while the stored information is still used.
+	if (serverInfoItr != m_storedInfos.cend() && !serverVerificationString.isEmpty()
+	    && QString::fromLatin1(serverInfoItr->verificationString().toBase64()) == serverVerificationString
+	    && m_storedInfosTimestamp.addDays(STORED_INFOS_MAX_AGE_DAYS) > QDateTime::currentDateTimeUtc()) {
+		qDebug() << "[client] [DiscoveryManager] Using the stored service discovery information of" << m_serverJid;
+		return;
+	}
+
+	requestServerInfos();
+}
+
+void DiscoveryManager::requestServerInfos()
+{
+	m_storedInfos.clear();
+	m_storedInfosTimestamp = QDateTime::currentDateTimeUtc();
+	m_requestedJids = { m_serverJid };
+	emit DiscoveryDb::instance()->removeDiscoInfosRequested(m_serverJid);
+
+	// request disco info & items from the server
+	m_manager->requestInfo(m_serverJid);
+	m_manager->requestItems(m_serverJid);
+}
@@ -30,25 +30,39 @@
 
 #pragma once
 
+#include <QDateTime>
 #include <QObject>
+#include <QSet>
 #include <QXmppClient.h>
+#include <QXmppDiscoveryIq.h>
 
 class QXmppDiscoveryManager;
+class StreamTracker;
 
 /**
  * @class DiscoveryManager Manager for outgoing/incoming service discovery requests and results
  *
  * XEP-0030: Service Discovery (https://xmpp.org/extensions/xep-0030.html)
+ *
+ * The information of the server and its items is stored in the database. After
+ * connecting, the stored information is emitted by infoReceived() as if it was received
+ * so that features like HTTP File Upload are available immediately. The information is
+ * only requested again if the server's verification string (XEP-0115) changed or if the
+ * stored information is outdated.
  */
 class DiscoveryManager : public QObject
 {
+	Q_OBJECT
+
 public:
-	DiscoveryManager(QXmppClient *client, QObject *parent = nullptr);
+	DiscoveryManager(QXmppClient *client, StreamTracker *streamTracker, QObject *parent = nullptr);
 
 	~DiscoveryManager();
 
 	/**
 	 * Will request disco info and items from the server (on connection)
+	 *
+	 * The stored information is used instead if it is still up to date.
 	 */
 	void handleConnection();
 
@@ -62,7 +76,38 @@ public:
 	 */
 	void handleInfo(const QXmppDiscoveryIq&);
 
+signals:
+	/**
+	 * Emitted when disco info was received or the stored one is used.
+	 *
+	 * Components using disco info (e.g. the message handler and the upload manager) must
+	 * use this signal instead of QXmppDiscoveryManager::infoReceived() since the stored
+	 * information is only emitted by this signal.
+	 */
+	void infoReceived(const QXmppDiscoveryIq &info);
+
 private:
+	void handleStoredInfosFetched(const QString &serverJid, const QVector<QXmppDiscoveryIq> &infos, const QDateTime &timestamp);
+
+	/**
+	 * Emits the stored information and requests it again if it is outdated.
+	 */
+	void useStoredInfos();
+
+	/**
+	 * Requests the information of the server and its items and replaces the stored one.
+	 */
+	void requestServerInfos();
+
 	QXmppClient *m_client;
+	StreamTracker *m_streamTracker;
 	QXmppDiscoveryManager *m_manager;
+
+	QString m_serverJid;
+	QVector<QXmppDiscoveryIq> m_storedInfos;
+	QDateTime m_storedInfosTimestamp;
+	QSet<QString> m_requestedJids;
+	bool m_isStoredInfosLoaded = false;
+	bool m_isStoredInfosLoading = false;
+	bool m_isConnectionPending = false;
 };
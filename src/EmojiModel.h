@@ -1,6 +1,7 @@
 #pragma once
 
 #include <QAbstractListModel>
+#include <QBitArray>
 #include <QSortFilterProxyModel>
 #include <QSet>
 
@@ -94,8 +95,12 @@ protected:
 	bool filterAcceptsRow(int sourceRow, const QModelIndex &sourceParent) const override;
 
 private:
+	void updateAcceptedRows();
+
 	Emoji::Group m_group = Emoji::Group::Invalid;
+	QString m_filter;
 	QSet<QString> m_favoriteEmojis;
+	QBitArray m_acceptedRows;
 };
 
 Q_DECLARE_METATYPE(Emoji)
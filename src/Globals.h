@@ -62,6 +62,11 @@ constexpr auto MESSAGE_MAX_CHARS = 1e4;
 #define DB_TABLE_INFO "dbinfo"
 #define DB_TABLE_ROSTER "Roster"
 #define DB_TABLE_MESSAGES "Messages"
+#define DB_TABLE_MAM_SYNC_STATE "MamSyncState"
+#define DB_TABLE_DISCO_INFOS "DiscoInfos"
+#define DB_TABLE_DISCO_ENTITIES "DiscoEntities"
+#define DB_TABLE_VCARDS "VCards"
+#define DB_TABLE_ROSTER_VERSIONS "RosterVersions"
 #define DB_QUERY_LIMIT_MESSAGES 20
 
 //
@@ -105,6 +110,21 @@ constexpr auto SERVER_LIST_MIN_SERVERS_FROM_COUNTRY = 2;
  */
 #define BITS_OF_BINARY_IMAGE_PROVIDER_NAME "bits-of-binary"
 
+/**
+ * Name of the @c QQuickAsyncImageProvider for avatars.
+ */
+#define AVATAR_IMAGE_PROVIDER_NAME "avatars"
+
+/**
+ * Sizes in pixels of the scaled variants stored for each avatar in ascending order.
+ */
+constexpr int AVATAR_VARIANT_SIZES[] = { 32, 48, 96 };
+
+/**
+ * Name of the @c QQuickAsyncImageProvider for QR codes.
+ */
+#define QR_CODE_IMAGE_PROVIDER_NAME "qr-codes"
+
 // JPEG export quality used when saving images lossy (e.g. when saving images from clipboard)
 constexpr auto JPEG_EXPORT_QUALITY = 85;
 
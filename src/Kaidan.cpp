@@ -42,11 +42,13 @@
 #include "AvatarFileStorage.h"
 #include "CredentialsValidator.h"
 #include "Database.h"
+#include "DiscoveryDb.h"
 #include "Globals.h"
 #include "MessageDb.h"
 #include "Notifications.h"
 #include "RosterDb.h"
 #include "Settings.h"
+#include "VCardDb.h"
 
 Kaidan *Kaidan::s_instance;
 
@@ -216,6 +218,12 @@ void Kaidan::initializeDatabase()
 	m_rosterDb = new RosterDb(m_database);
 	m_rosterDb->moveToThread(m_dbThrd);
 
+	m_discoveryDb = new DiscoveryDb(m_database);
+	m_discoveryDb->moveToThread(m_dbThrd);
+
+	m_vCardDb = new VCardDb(m_database);
+	m_vCardDb->moveToThread(m_dbThrd);
+
 	connect(m_dbThrd, &QThread::started, m_database, &Database::openDatabase);
 	m_dbThrd->start();
 }
@@ -40,6 +40,8 @@ class Database;
 class DataFormModel;
 class RosterDb;
 class MessageDb;
+class DiscoveryDb;
+class VCardDb;
 class QXmppClient;
 
 /**
@@ -401,6 +403,8 @@ private:
 	QThread *m_dbThrd;
 	MessageDb *m_msgDb;
 	RosterDb *m_rosterDb;
+	DiscoveryDb *m_discoveryDb;
+	VCardDb *m_vCardDb;
 	QThread *m_cltThrd;
 	ClientWorker::Caches *m_caches;
 	ClientWorker *m_client;
@@ -0,0 +1,241 @@
+/*
+ *  Kaidan - A user-friendly XMPP client for every device!
+ *
+ *  Copyright (C) 2016-2021 Kaidan developers and contributors
+ *  (see the LICENSE file for a full list of copyright authors)
+ *
+ *  Kaidan is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  In addition, as a special exception, the author of Kaidan gives
+ *  permission to link the code of its release with the OpenSSL
+ *  project's "OpenSSL" library (or with modified versions of it that
+ *  use the same license as the "OpenSSL" library), and distribute the
+ *  linked executables. You must obey the GNU General Public License in
+ *  all respects for all of the code used other than "OpenSSL". If you
+ *  modify this file, you may extend this exception to your version of
+ *  the file, but you are not obligated to do so.  If you do not wish to
+ *  do so, delete this exception statement from your version.
+ *
+ *  Kaidan is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Kaidan.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "MamQueryScheduler.h"
+
+#include <algorithm>
+#include <chrono>
+
+// Qt
+#include <QDebug>
+#include <QTimer>
+
+using namespace std::chrono_literals;
+
+// Default number of queries running at once
+constexpr int MAM_QUERY_DEFAULT_MAX_RUNNING = 10;
+
+// Default time after which a query without a result is considered to be failed
+constexpr auto MAM_QUERY_DEFAULT_TIMEOUT = 30s;
+
+// Number of checks for timeouts of running queries within the timeout
+constexpr int MAM_QUERY_TIMEOUT_CHECKS = 6;
+
+// Number of attempts for a query before it is given up
+constexpr int MAM_QUERY_MAX_ATTEMPTS = 3;
+
+MamQueryScheduler::MamQueryScheduler(const QueryStarter &queryStarter, QObject *parent)
+	: QObject(parent),
+	  m_queryStarter(queryStarter),
+	  m_maxRunningQueries(MAM_QUERY_DEFAULT_MAX_RUNNING),
+	  m_queryTimeout(std::chrono::milliseconds(MAM_QUERY_DEFAULT_TIMEOUT).count()),
+	  m_timeoutTimer(new QTimer(this))
+{
+	m_timeoutTimer->setInterval(m_queryTimeout / MAM_QUERY_TIMEOUT_CHECKS);
+	m_timeoutTimer->callOnTimeout(this, &MamQueryScheduler::handleTimeouts);
+}
+
+MamQueryScheduler::~MamQueryScheduler() = default;
+
+int MamQueryScheduler::maxRunningQueries() const
+{
+	return m_maxRunningQueries;
+}
+
+void MamQueryScheduler::setMaxRunningQueries(int maxRunningQueries)
+{
+	m_maxRunningQueries = std::max(1, maxRunningQueries);
+	startQueries();
+}
+
+int MamQueryScheduler::queryTimeout() const
+{
+	return m_queryTimeout;
+}
+
+void MamQueryScheduler::setQueryTimeout(int queryTimeout)
+{
+	m_queryTimeout = std::max(MAM_QUERY_TIMEOUT_CHECKS, queryTimeout);
+	m_timeoutTimer->setInterval(m_queryTimeout / MAM_QUERY_TIMEOUT_CHECKS);
+}
+
+void MamQueryScheduler::enqueue(const QString &jid, Priority priority)
+{
+	if (jid == m_prioritizedJid) {
+		priority = HighPriority;
+		m_prioritizedJid.clear();
+	}
+
+	m_queues[priority].append({ jid, priority });
+	m_totalQueries++;
+
+	startQueries();
+}
+
+bool MamQueryScheduler::finishQuery(const QString &queryId)
+{
+	if (!m_runningQueries.remove(queryId))
+		return false;
+
+	m_finishedQueries++;
+	handleQueryCompletion();
+	return true;
+}
+
+bool MamQueryScheduler::isQueryRunning(const QString &queryId) const
+{
+	return m_runningQueries.contains(queryId);
+}
+
+bool MamQueryScheduler::isIdle() const
+{
+	return m_runningQueries.isEmpty() && queueDepth() == 0;
+}
+
+int MamQueryScheduler::queueDepth() const
+{
+	int depth = 0;
+	for (const auto &queue : m_queues)
+		depth += queue.size();
+	return depth;
+}
+
+void MamQueryScheduler::clear()
+{
+	for (auto &queue : m_queues)
+		queue.clear();
+
+	m_runningQueries.clear();
+	m_timeoutTimer->stop();
+
+	m_finishedQueries = 0;
+	m_totalQueries = 0;
+}
+
+void MamQueryScheduler::prioritize(const QString &jid)
+{
+	for (int priority = LowPriority; priority < HighPriority; priority++) {
+		auto &queue = m_queues[priority];
+		const auto itr = std::find_if(queue.begin(), queue.end(), [&jid](const Query &query) {
+			return query.jid == jid;
+		});
+
+		if (itr != queue.end()) {
+			auto query = *itr;
+			queue.erase(itr);
+
+			query.priority = HighPriority;
+			m_queues[HighPriority].prepend(query);
+			return;
+		}
+	}
+
+	// the query is either running, already in the front of the queue or not enqueued yet
+	const auto &highPriorityQueue = m_queues[HighPriority];
+	const auto isQueued = std::any_of(highPriorityQueue.cbegin(), highPriorityQueue.cend(), [&jid](const Query &query) {
+		return query.jid == jid;
+	});
+	const auto isRunning = std::any_of(m_runningQueries.cbegin(), m_runningQueries.cend(), [&jid](const RunningQuery &runningQuery) {
+		return runningQuery.query.jid == jid;
+	});
+
+	if (!isQueued && !isRunning)
+		m_prioritizedJid = jid;
+}
+
+void MamQueryScheduler::startQueries()
+{
+	while (m_runningQueries.size() < m_maxRunningQueries) {
+		// take the query with the highest priority
+		QList<Query> *queue = nullptr;
+		for (int priority = HighPriority; priority >= LowPriority; priority--) {
+			if (!m_queues[priority].isEmpty()) {
+				queue = &m_queues[priority];
+				break;
+			}
+		}
+
+		if (!queue)
+			break;
+
+		RunningQuery runningQuery { queue->takeFirst(), {} };
+		runningQuery.query.attempts++;
+		runningQuery.timer.start();
+		m_runningQueries.insert(m_queryStarter(runningQuery.query.jid), runningQuery);
+	}
+
+	if (!m_runningQueries.isEmpty() && !m_timeoutTimer->isActive())
+		m_timeoutTimer->start();
+}
+
+void MamQueryScheduler::handleTimeouts()
+{
+	bool queriesFailed = false;
+
+	for (auto itr = m_runningQueries.begin(); itr != m_runningQueries.end();) {
+		if (!itr->timer.hasExpired(m_queryTimeout)) {
+			itr++;
+			continue;
+		}
+
+		const auto query = itr->query;
+		itr = m_runningQueries.erase(itr);
+
+		// results of the timed out query are ignored from now on
+		if (query.attempts < MAM_QUERY_MAX_ATTEMPTS) {
+			qDebug() << "[client] [MamQueryScheduler] Query for" << query.jid << "timed out, retrying";
+			m_queues[query.priority].prepend(query);
+		} else {
+			qWarning() << "[client] [MamQueryScheduler] Query for" << query.jid << "failed"
+			           << query.attempts << "times, giving up";
+			m_finishedQueries++;
+		}
+
+		queriesFailed = true;
+	}
+
+	if (queriesFailed)
+		handleQueryCompletion();
+}
+
+void MamQueryScheduler::handleQueryCompletion()
+{
+	startQueries();
+
+	emit progressChanged(m_finishedQueries, m_totalQueries, queueDepth());
+
+	if (isIdle()) {
+		m_timeoutTimer->stop();
+		m_finishedQueries = 0;
+		m_totalQueries = 0;
+
+		emit allQueriesFinished();
+	}
+}
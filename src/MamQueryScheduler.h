@@ -0,0 +1,182 @@
+/*
+ *  Kaidan - A user-friendly XMPP client for every device!
+ *
+ *  Copyright (C) 2016-2021 Kaidan developers and contributors
+ *  (see the LICENSE file for a full list of copyright authors)
+ *
+ *  Kaidan is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  In addition, as a special exception, the author of Kaidan gives
+ *  permission to link the code of its release with the OpenSSL
+ *  project's "OpenSSL" library (or with modified versions of it that
+ *  use the same license as the "OpenSSL" library), and distribute the
+ *  linked executables. You must obey the GNU General Public License in
+ *  all respects for all of the code used other than "OpenSSL". If you
+ *  modify this file, you may extend this exception to your version of
+ *  the file, but you are not obligated to do so.  If you do not wish to
+ *  do so, delete this exception statement from your version.
+ *
+ *  Kaidan is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Kaidan.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+// std
+#include <functional>
+// Qt
+#include <QElapsedTimer>
+#include <QHash>
+#include <QList>
+#include <QObject>
+
+class QTimer;
+
+/**
+ * @class MamQueryScheduler Scheduler for MAM queries of multiple chats
+ *
+ * Only a limited number of queries is running at once while the remaining ones are
+ * queued by their priorities. Queries without a result in time are retried.
+ */
+class MamQueryScheduler : public QObject
+{
+	Q_OBJECT
+
+public:
+	enum Priority : quint8 {
+		LowPriority,
+		NormalPriority,
+		HighPriority,
+	};
+
+	/**
+	 * Function starting a MAM query for a chat and returning the query's ID
+	 */
+	using QueryStarter = std::function<QString (const QString &jid)>;
+
+	/**
+	 * @param queryStarter function used to start the queries
+	 * @param parent optional QObject-based parent
+	 */
+	explicit MamQueryScheduler(const QueryStarter &queryStarter, QObject *parent = nullptr);
+	~MamQueryScheduler();
+
+	/**
+	 * Returns the maximum number of queries running at once.
+	 */
+	int maxRunningQueries() const;
+
+	/**
+	 * Sets the maximum number of queries running at once.
+	 */
+	void setMaxRunningQueries(int maxRunningQueries);
+
+	/**
+	 * Returns the time in milliseconds after which a query without a result is retried.
+	 */
+	int queryTimeout() const;
+
+	/**
+	 * Sets the time in milliseconds after which a query without a result is retried.
+	 */
+	void setQueryTimeout(int queryTimeout);
+
+	/**
+	 * Enqueues a query for a chat and starts it as soon as possible.
+	 *
+	 * @param jid JID of the chat
+	 * @param priority priority of the query
+	 */
+	void enqueue(const QString &jid, Priority priority = NormalPriority);
+
+	/**
+	 * Marks a query as finished and starts the next queued one.
+	 *
+	 * @param queryId ID of the query
+	 *
+	 * @return true if the query was started by this scheduler, otherwise false
+	 */
+	bool finishQuery(const QString &queryId);
+
+	/**
+	 * Returns whether a query was started by this scheduler and is still running.
+	 *
+	 * @param queryId ID of the query
+	 */
+	bool isQueryRunning(const QString &queryId) const;
+
+	/**
+	 * Returns whether no query is running or queued.
+	 */
+	bool isIdle() const;
+
+	/**
+	 * Returns the number of queued queries.
+	 */
+	int queueDepth() const;
+
+	/**
+	 * Removes all queued queries and forgets about the running ones.
+	 */
+	void clear();
+
+	/**
+	 * Moves the query of a chat to the front of the queue.
+	 *
+	 * If the query is not enqueued yet, it will get the highest priority as soon as it
+	 * is enqueued.
+	 *
+	 * @param jid JID of the chat
+	 */
+	Q_SLOT void prioritize(const QString &jid);
+
+signals:
+	/**
+	 * Emitted when a query finished, failed or timed out.
+	 *
+	 * @param finishedQueries number of finished or failed queries
+	 * @param totalQueries number of all queries since the scheduler was idle
+	 * @param queueDepth number of queued queries
+	 */
+	void progressChanged(int finishedQueries, int totalQueries, int queueDepth);
+
+	/**
+	 * Emitted when all queries are finished.
+	 */
+	void allQueriesFinished();
+
+private:
+	struct Query {
+		QString jid;
+		Priority priority;
+		int attempts = 0;
+	};
+
+	struct RunningQuery {
+		Query query;
+		QElapsedTimer timer;
+	};
+
+	void startQueries();
+	void handleTimeouts();
+	void handleQueryCompletion();
+
+	QueryStarter m_queryStarter;
+	int m_maxRunningQueries;
+	int m_queryTimeout;
+	QList<Query> m_queues[HighPriority + 1];
+	QHash<QString, RunningQuery> m_runningQueries;
+	QString m_prioritizedJid;
+	QTimer *m_timeoutTimer;
+
+	int m_finishedQueries = 0;
+	int m_totalQueries = 0;
+};
@@ -0,0 +1,99 @@
+/*
+ *  Kaidan - A user-friendly XMPP client for every device!
+ *
+ *  Copyright (C) 2016-2021 Kaidan developers and contributors
+ *  (see the LICENSE file for a full list of copyright authors)
+ *
+ *  Kaidan is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  In addition, as a special exception, the author of Kaidan gives
+ *  permission to link the code of its release with the OpenSSL
+ *  project's "OpenSSL" library (or with modified versions of it that
+ *  use the same license as the "OpenSSL" library), and distribute the
+ *  linked executables. You must obey the GNU General Public License in
+ *  all respects for all of the code used other than "OpenSSL". If you
+ *  modify this file, you may extend this exception to your version of
+ *  the file, but you are not obligated to do so.  If you do not wish to
+ *  do so, delete this exception statement from your version.
+ *
+ *  Kaidan is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Kaidan.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "MamQueryWatcher.h"
+
+#include <chrono>
+
+// Qt
+#include <QDomElement>
+#include <QTimer>
+
+using namespace std::chrono_literals;
+
+// Default time after which a query without a result is considered to be failed
+constexpr auto MAM_QUERY_WATCHER_DEFAULT_TIMEOUT = 30s;
+
+MamQueryWatcher::MamQueryWatcher()
+	: m_timeoutTimer(new QTimer(this))
+{
+	m_timeoutTimer->setSingleShot(true);
+	m_timeoutTimer->setInterval(MAM_QUERY_WATCHER_DEFAULT_TIMEOUT);
+	m_timeoutTimer->callOnTimeout(this, &MamQueryWatcher::fail);
+}
+
+int MamQueryWatcher::queryTimeout() const
+{
+	return m_timeoutTimer->interval();
+}
+
+void MamQueryWatcher::setQueryTimeout(int queryTimeout)
+{
+	m_timeoutTimer->setInterval(queryTimeout);
+}
+
+void MamQueryWatcher::watch(const QString &queryId)
+{
+	m_queryId = queryId;
+	m_timeoutTimer->start();
+}
+
+void MamQueryWatcher::finish()
+{
+	m_queryId.clear();
+	m_timeoutTimer->stop();
+}
+
+QString MamQueryWatcher::queryId() const
+{
+	return m_queryId;
+}
+
+bool MamQueryWatcher::handleStanza(const QDomElement &element)
+{
+	// QXmppMamManager uses the query's ID as the ID of the IQ request.
+	if (!m_queryId.isEmpty() && element.tagName() == QStringLiteral("iq")
+	    && element.attribute(QStringLiteral("type")) == QStringLiteral("error")
+	    && element.attribute(QStringLiteral("id")) == m_queryId) {
+		fail();
+		return true;
+	}
+
+	return false;
+}
+
+void MamQueryWatcher::fail()
+{
+	const auto queryId = m_queryId;
+	finish();
+
+	if (!queryId.isEmpty())
+		emit queryFailed(queryId);
+}
@@ -0,0 +1,100 @@
+/*
+ *  Kaidan - A user-friendly XMPP client for every device!
+ *
+ *  Copyright (C) 2016-2021 Kaidan developers and contributors
+ *  (see the LICENSE file for a full list of copyright authors)
+ *
+ *  Kaidan is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  In addition, as a special exception, the author of Kaidan gives
+ *  permission to link the code of its release with the OpenSSL
+ *  project's "OpenSSL" library (or with modified versions of it that
+ *  use the same license as the "OpenSSL" library), and distribute the
+ *  linked executables. You must obey the GNU General Public License in
+ *  all respects for all of the code used other than "OpenSSL". If you
+ *  modify this file, you may extend this exception to your version of
+ *  the file, but you are not obligated to do so.  If you do not wish to
+ *  do so, delete this exception statement from your version.
+ *
+ *  Kaidan is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Kaidan.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+// Qt
+#include <QElapsedTimer>
+#include <QString>
+// QXmpp
+#include <QXmppClientExtension.h>
+
+class QTimer;
+
+/**
+ * @class MamQueryWatcher Watcher detecting a failed MAM query
+ *
+ * QXmppMamManager does not report error responses to queries. Thus, this extension
+ * watches the responses of the client and reports a query as failed if the server
+ * responds with an error or if no result is received in time.
+ *
+ * Only one query is watched at once.
+ */
+class MamQueryWatcher : public QXmppClientExtension
+{
+	Q_OBJECT
+
+public:
+	MamQueryWatcher();
+
+	/**
+	 * Returns the time in milliseconds after which a query without a result is failed.
+	 */
+	int queryTimeout() const;
+
+	/**
+	 * Sets the time in milliseconds after which a query without a result is failed.
+	 */
+	void setQueryTimeout(int queryTimeout);
+
+	/**
+	 * Starts watching a query.
+	 *
+	 * @param queryId ID of the query as returned by QXmppMamManager
+	 */
+	void watch(const QString &queryId);
+
+	/**
+	 * Stops watching the current query, e.g., when its result was received.
+	 */
+	void finish();
+
+	/**
+	 * Returns the ID of the watched query or an empty string if no query is watched.
+	 */
+	QString queryId() const;
+
+	bool handleStanza(const QDomElement &element) override;
+
+signals:
+	/**
+	 * Emitted when the server responded to the watched query with an error or when no
+	 * result was received in time.
+	 *
+	 * @param queryId ID of the failed query
+	 */
+	void queryFailed(const QString &queryId);
+
+private:
+	void fail();
+
+	QTimer *m_timeoutTimer;
+	QString m_queryId;
+};
@@ -30,32 +30,34 @@
 
 #include "MediaUtils.h"
 
+#include <QElapsedTimer>
 #include <QFileInfo>
 #include <QRegularExpression>
 #include <QTime>
 #include <QUrl>
 
+#include "LoggingCategories.h"
+
+// Maximum number of suffixes whose MIME types are cached
+constexpr int MIME_TYPE_CACHE_MAX_SIZE = 256;
+
 static QList<QMimeType> mimeTypes(const QList<QMimeType> &mimeTypes, const QString &parent);
+static QHash<QString, Enums::MessageType> messageTypes(const QList<std::pair<Enums::MessageType, QList<QMimeType>>> &mimeTypes);
 
 const QMimeDatabase MediaUtils::s_mimeDB;
-const QList<QMimeType> MediaUtils::s_allMimeTypes(MediaUtils::s_mimeDB.allMimeTypes());
-const QList<QMimeType> MediaUtils::s_imageTypes(::mimeTypes(MediaUtils::s_allMimeTypes, QStringLiteral("image")));
-const QList<QMimeType> MediaUtils::s_audioTypes(::mimeTypes(MediaUtils::s_allMimeTypes, QStringLiteral("audio")));
-const QList<QMimeType> MediaUtils::s_videoTypes(::mimeTypes(MediaUtils::s_allMimeTypes, QStringLiteral("video")));
-const QList<QMimeType> MediaUtils::s_documentTypes {
-	s_mimeDB.mimeTypeForName(QStringLiteral("application/vnd.oasis.opendocument.presentation")),
-	s_mimeDB.mimeTypeForName(QStringLiteral("application/vnd.oasis.opendocument.spreadsheet")),
-	s_mimeDB.mimeTypeForName(QStringLiteral("application/vnd.oasis.opendocument.text")),
-	s_mimeDB.mimeTypeForName(QStringLiteral("application/vnd.openxmlformats-officedocument.presentationml.presentation")),
-	s_mimeDB.mimeTypeForName(QStringLiteral("application/vnd.openxmlformats-officedocument.spreadsheetml.sheet")),
-	s_mimeDB.mimeTypeForName(QStringLiteral("application/vnd.openxmlformats-officedocument.wordprocessingml.document")),
-	s_mimeDB.mimeTypeForName(QStringLiteral("application/pdf")),
-	s_mimeDB.mimeTypeForName(QStringLiteral("text/plain"))
-};
-const QList<QMimeType> MediaUtils::s_geoTypes {
-	s_mimeDB.mimeTypeForName(QStringLiteral("application/geo+json"))
-};
 const QRegularExpression MediaUtils::s_geoLocationRegExp(QStringLiteral("geo:([-+]?[0-9]*\\.?[0-9]+),([-+]?[0-9]*\\.?[0-9]+)"));
+QHash<QString, MediaUtils::MimeTypeInfo> MediaUtils::s_mimeTypeCache;
+QReadWriteLock MediaUtils::s_mimeTypeCacheLock;
+
+static QList<QMimeType> mimeTypes(const QMimeDatabase &mimeDB, const QStringList &names) {
+	QList<QMimeType> mimes;
+
+	for (const QString &name : names) {
+		mimes << mimeDB.mimeTypeForName(name);
+	}
+
+	return mimes;
+}
 
 static QList<QMimeType> mimeTypes(const QList<QMimeType> &mimeTypes, const QString &parent) {
 	QList<QMimeType> mimes;
@@ -69,6 +71,20 @@ static QList<QMimeType> mimeTypes(const QList<QMimeType> &mimeTypes, const QStri
 	return  mimes;
 }
 
+static QHash<QString, Enums::MessageType> messageTypes(const QList<std::pair<Enums::MessageType, QList<QMimeType>>> &mimeTypes) {
+	QHash<QString, Enums::MessageType> types;
+
+	for (const auto &[messageType, categoryMimeTypes] : mimeTypes) {
+		for (const QMimeType &mimeType : categoryMimeTypes) {
+			if (!types.contains(mimeType.name())) {
+				types.insert(mimeType.name(), messageType);
+			}
+		}
+	}
+
+	return types;
+}
+
 static QString iconName(const QList<QMimeType> &mimeTypes) {
 	if (!mimeTypes.isEmpty()) {
 		for (const QMimeType &type: mimeTypes) {
@@ -157,6 +173,49 @@ bool MediaUtils::isGeoLocation(const QString &content)
 	return s_geoLocationRegExp.match(content).hasMatch();
 }
 
+void MediaUtils::preloadMimeTypes()
+{
+	mimeTypeTables();
+}
+
+QVector<MediaUtils::UriSpan> MediaUtils::findUris(const QString &text)
+{
+	QVector<UriSpan> spans;
+
+	// Each supported URI contains a colon. Searching for it is much cheaper than
+	// splitting the text into words.
+	if (!text.contains(u':'))
+		return spans;
+
+	const QStringView view(text);
+	const int size = view.size();
+	int position = 0;
+
+	while (position < size) {
+		// skip whitespace before the next word
+		while (position < size && view.at(position).isSpace())
+			position++;
+
+		const int wordPosition = position;
+		while (position < size && !view.at(position).isSpace())
+			position++;
+
+		const auto word = view.mid(wordPosition, position - wordPosition);
+		if (word.startsWith(QLatin1String("http://"), Qt::CaseInsensitive)
+		    || word.startsWith(QLatin1String("https://"), Qt::CaseInsensitive)) {
+			const QUrl url(word.toString());
+			if (url.isValid())
+				spans.append({ wordPosition, int(word.size()), url });
+		} else if (word.startsWith(QLatin1String("geo:"), Qt::CaseInsensitive)) {
+			const auto uri = word.toString();
+			if (isGeoLocation(uri))
+				spans.append({ wordPosition, int(word.size()), QUrl(uri) });
+		}
+	}
+
+	return spans;
+}
+
 QGeoCoordinate MediaUtils::locationCoordinate(const QString &content)
 {
 	const QRegularExpressionMatch match = s_geoLocationRegExp.match(content);
@@ -214,10 +273,10 @@ QMimeType MediaUtils::mimeType(const QUrl &url)
 	}
 
 	if (url.scheme().compare(QStringLiteral("geo")) == 0) {
-		return s_geoTypes.first();
+		return mimeTypeTables().geoTypes.first();
 	}
 
-	return mimeType(url.fileName());
+	return mimeTypeInfo(url.fileName()).mimeType;
 }
 
 QString MediaUtils::iconName(const QString &filePath)
@@ -391,15 +450,15 @@ QList<QMimeType> MediaUtils::mimeTypes(Enums::MessageType hint)
 {
 	switch (hint) {
 	case Enums::MessageType::MessageImage:
-		return s_imageTypes;
+		return mimeTypeTables().imageTypes;
 	case Enums::MessageType::MessageVideo:
-		return s_videoTypes;
+		return mimeTypeTables().videoTypes;
 	case Enums::MessageType::MessageAudio:
-		return s_audioTypes;
+		return mimeTypeTables().audioTypes;
 	case Enums::MessageType::MessageDocument:
-		return s_documentTypes;
+		return mimeTypeTables().documentTypes;
 	case Enums::MessageType::MessageGeoLocation:
-		return s_geoTypes;
+		return mimeTypeTables().geoTypes;
 	case Enums::MessageType::MessageText:
 	case Enums::MessageType::MessageUnknown:
 		break;
@@ -433,29 +492,17 @@ Enums::MessageType MediaUtils::messageType(const QUrl &url)
 		return messageType(url.toLocalFile());
 	}
 
-	QList<QMimeType> mimeTypes;
-
 	if (url.scheme().compare(QStringLiteral("geo")) == 0) {
-		mimeTypes = s_geoTypes;
-	} else {
-		const QFileInfo fileInfo(url.fileName());
-
-		if (fileInfo.completeSuffix().isEmpty()) {
-			return Enums::MessageType::MessageUnknown;
-		}
-
-		mimeTypes = s_mimeDB.mimeTypesForFileName(fileInfo.fileName());
+		return Enums::MessageType::MessageGeoLocation;
 	}
 
-	for (const QMimeType &mimeType : std::as_const(mimeTypes)) {
-		const Enums::MessageType messageType = MediaUtils::messageType(mimeType);
+	const QString fileName = url.fileName();
 
-		if (messageType != Enums::MessageType::MessageUnknown) {
-			return messageType;
-		}
+	if (QFileInfo(fileName).completeSuffix().isEmpty()) {
+		return Enums::MessageType::MessageUnknown;
 	}
 
-	return Enums::MessageType::MessageUnknown;
+	return mimeTypeInfo(fileName).messageType;
 }
 
 Enums::MessageType MediaUtils::messageType(const QMimeType &mimeType)
@@ -464,17 +511,79 @@ Enums::MessageType MediaUtils::messageType(const QMimeType &mimeType)
 		return Enums::MessageType::MessageUnknown;
 	}
 
-	if (mimeTypes(Enums::MessageType::MessageImage).contains(mimeType)) {
-		return Enums::MessageType::MessageImage;
-	} else if (mimeTypes(Enums::MessageType::MessageAudio).contains(mimeType)) {
-		return Enums::MessageType::MessageAudio;
-	} else if (mimeTypes(Enums::MessageType::MessageVideo).contains(mimeType)) {
-		return Enums::MessageType::MessageVideo;
-	} else if (mimeTypes(Enums::MessageType::MessageGeoLocation).contains(mimeType)) {
-		return Enums::MessageType::MessageGeoLocation;
-	} else if (mimeTypes(Enums::MessageType::MessageDocument).contains(mimeType)) {
-		return Enums::MessageType::MessageDocument;
+	return mimeTypeTables().messageTypes.value(mimeType.name(), Enums::MessageType::MessageFile);
+}
+
+const MediaUtils::MimeTypeTables &MediaUtils::mimeTypeTables()
+{
+	// Loading all MIME types parses the whole MIME database. Thus, it is not done
+	// during the static initialization but on first use (thread-safe since C++11).
+	static const MimeTypeTables tables = [] {
+		QElapsedTimer timer;
+		timer.start();
+
+		MimeTypeTables tables;
+		const QList<QMimeType> allMimeTypes = s_mimeDB.allMimeTypes();
+		tables.imageTypes = ::mimeTypes(allMimeTypes, QStringLiteral("image"));
+		tables.audioTypes = ::mimeTypes(allMimeTypes, QStringLiteral("audio"));
+		tables.videoTypes = ::mimeTypes(allMimeTypes, QStringLiteral("video"));
+		tables.documentTypes = ::mimeTypes(s_mimeDB, {
+			QStringLiteral("application/vnd.oasis.opendocument.presentation"),
+			QStringLiteral("application/vnd.oasis.opendocument.spreadsheet"),
+			QStringLiteral("application/vnd.oasis.opendocument.text"),
+			QStringLiteral("application/vnd.openxmlformats-officedocument.presentationml.presentation"),
+			QStringLiteral("application/vnd.openxmlformats-officedocument.spreadsheetml.sheet"),
+			QStringLiteral("application/vnd.openxmlformats-officedocument.wordprocessingml.document"),
+			QStringLiteral("application/pdf"),
+			QStringLiteral("text/plain")
+		});
+		tables.geoTypes = ::mimeTypes(s_mimeDB, { QStringLiteral("application/geo+json") });
+
+		// ordered by priority for MIME types belonging to multiple categories
+		tables.messageTypes = ::messageTypes({
+			{ Enums::MessageType::MessageImage, tables.imageTypes },
+			{ Enums::MessageType::MessageAudio, tables.audioTypes },
+			{ Enums::MessageType::MessageVideo, tables.videoTypes },
+			{ Enums::MessageType::MessageGeoLocation, tables.geoTypes },
+			{ Enums::MessageType::MessageDocument, tables.documentTypes }
+		});
+
+		qCDebug(KAIDAN_STARTUP_LOG) << "Loaded MIME types in" << timer.elapsed() << "ms";
+		return tables;
+	}();
+
+	return tables;
+}
+
+MediaUtils::MimeTypeInfo MediaUtils::mimeTypeInfo(const QString &fileName)
+{
+	const QFileInfo fileInfo(fileName);
+	const QString suffix = fileInfo.suffix().toLower();
+
+	// Names without a suffix are not cached. Neither are names with multiple suffixes
+	// since their MIME type can depend on more than the last one (e.g. "tar.gz").
+	if (suffix.isEmpty() || suffix.size() != fileInfo.completeSuffix().size()) {
+		const QMimeType mimeType = s_mimeDB.mimeTypeForFile(fileName, QMimeDatabase::MatchExtension);
+		return { mimeType, messageType(mimeType) };
 	}
 
-	return Enums::MessageType::MessageFile;
+	{
+		QReadLocker locker(&s_mimeTypeCacheLock);
+		const auto itr = s_mimeTypeCache.constFind(suffix);
+		if (itr != s_mimeTypeCache.constEnd()) {
+			return *itr;
+		}
+	}
+
+	const QMimeType mimeType = s_mimeDB.mimeTypeForFile(fileName, QMimeDatabase::MatchExtension);
+	const MimeTypeInfo info { mimeType, messageType(mimeType) };
+
+	QWriteLocker locker(&s_mimeTypeCacheLock);
+
+	// The file names are chosen by others. Thus, the cache is limited.
+	if (s_mimeTypeCache.size() >= MIME_TYPE_CACHE_MAX_SIZE)
+		s_mimeTypeCache.clear();
+
+	s_mimeTypeCache.insert(suffix, info);
+	return info;
 }
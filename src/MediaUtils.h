@@ -31,8 +31,12 @@
 #pragma once
 
 #include <QGeoCoordinate>
+#include <QHash>
 #include <QMimeDatabase>
 #include <QObject>
+#include <QReadWriteLock>
+#include <QUrl>
+#include <QVector>
 
 #include "Enums.h"
 
@@ -41,6 +45,15 @@ class MediaUtils : public QObject
 	Q_OBJECT
 
 public:
+	/**
+	 * Position of an HTTP(S) or geo URI within a text
+	 */
+	struct UriSpan {
+		int position;
+		int length;
+		QUrl url;
+	};
+
 	using QObject::QObject;
 
 	Q_INVOKABLE static QString prettyDuration(int msecs);
@@ -48,6 +61,20 @@ public:
 	Q_INVOKABLE static bool isHttp(const QString &content);
 	Q_INVOKABLE static bool isGeoLocation(const QString &content);
 	Q_INVOKABLE static QGeoCoordinate locationCoordinate(const QString &content);
+
+	/**
+	 * Loads the MIME types of all message types.
+	 *
+	 * They are loaded on first use otherwise. This can be called from any thread.
+	 */
+	static void preloadMimeTypes();
+
+	/**
+	 * Finds all HTTP(S) and geo URIs within a text in one pass.
+	 *
+	 * Only words starting with a supported scheme are parsed as URLs.
+	 */
+	static QVector<UriSpan> findUris(const QString &text);
 	Q_INVOKABLE static bool localFileAvailable(const QString &filePath);
 	Q_INVOKABLE static bool localFileAvailable(const QUrl &url);
 	Q_INVOKABLE static QUrl fromLocalFile(const QString &filePath);
@@ -77,12 +104,35 @@ public:
 	{ return mimeType(url).name(); }
 
 private:
+	struct MimeTypeTables {
+		QList<QMimeType> imageTypes;
+		QList<QMimeType> audioTypes;
+		QList<QMimeType> videoTypes;
+		QList<QMimeType> documentTypes;
+		QList<QMimeType> geoTypes;
+		QHash<QString, Enums::MessageType> messageTypes;
+	};
+
+	/**
+	 * Returns the MIME types of all message types, loading them on first use.
+	 */
+	static const MimeTypeTables &mimeTypeTables();
+
+	struct MimeTypeInfo {
+		QMimeType mimeType;
+		Enums::MessageType messageType;
+	};
+
+	/**
+	 * Returns the MIME type and message type for the name of a remote file by its
+	 * extension.
+	 *
+	 * The results are cached by the file name's lower-cased suffix.
+	 */
+	static MimeTypeInfo mimeTypeInfo(const QString &fileName);
+
 	static const QMimeDatabase s_mimeDB;
-	static const QList<QMimeType> s_allMimeTypes;
-	static const QList<QMimeType> s_imageTypes;
-	static const QList<QMimeType> s_audioTypes;
-	static const QList<QMimeType> s_videoTypes;
-	static const QList<QMimeType> s_documentTypes;
-	static const QList<QMimeType> s_geoTypes;
 	static const QRegularExpression s_geoLocationRegExp;
+	static QHash<QString, MimeTypeInfo> s_mimeTypeCache;
+	static QReadWriteLock s_mimeTypeCacheLock;
 };
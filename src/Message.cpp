@@ -203,6 +203,26 @@ void Message::setErrorText(const QString &errText)
 	m_errorText = errText;
 }
 
+qint64 Message::receptionTime() const
+{
+	return m_receptionTime;
+}
+
+void Message::setReceptionTime(qint64 receptionTime)
+{
+	m_receptionTime = receptionTime;
+}
+
+QString Message::formattedBody() const
+{
+	return m_formattedBody;
+}
+
+void Message::setFormattedBody(const QString &formattedBody)
+{
+	m_formattedBody = formattedBody;
+}
+
 QString Message::previewText() const
 {
 	if (isSpoiler()) {
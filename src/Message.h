@@ -32,6 +32,7 @@
 
 // Qt
 #include <QCoreApplication>
+#include <QHash>
 // QXmpp
 #include <QXmppMessage.h>
 // Kaidan
@@ -85,6 +86,12 @@ public:
 	QString errorText() const;
 	void setErrorText(const QString &errText);
 
+	qint64 receptionTime() const;
+	void setReceptionTime(qint64 receptionTime);
+
+	QString formattedBody() const;
+	void setFormattedBody(const QString &formattedBody);
+
 	/**
 	 * Preview of the message in pure text form (used in the contact list for the
 	 * last message for example)
@@ -136,6 +143,19 @@ private:
 	 * Text description of an error if it ever happened to the message
 	 */
 	QString m_errorText;
+
+	/**
+	 * Time in milliseconds of a monotonic clock (see QDeadlineTimer::current()) at which the message
+	 * was received or created by the user. It is not stored in the database and only
+	 * used for measuring how long it takes to display the message.
+	 */
+	qint64 m_receptionTime = 0;
+
+	/**
+	 * Body formatted for displaying it (e.g. with highlighted links). It is not stored in
+	 * the database but created once by the URIs found in the body.
+	 */
+	QString m_formattedBody;
 };
 
 Q_DECLARE_METATYPE(Message)
@@ -149,3 +169,32 @@ enum class MessageOrigin : quint8 {
 };
 
 Q_DECLARE_METATYPE(MessageOrigin);
+
+/**
+ * Message added to the database that is applied to the models together with other
+ * added messages in one batch.
+ */
+struct AddedMessage
+{
+	Message message;
+	MessageOrigin origin;
+};
+
+Q_DECLARE_METATYPE(AddedMessage)
+
+/**
+ * Delivery state change of a message that is applied together with other changes in
+ * one batch.
+ */
+struct DeliveryStateUpdate
+{
+	DeliveryState deliveryState;
+	QString errorText;
+};
+
+/**
+ * Delivery state changes mapped to the IDs of the messages they belong to
+ */
+using DeliveryStateUpdates = QHash<QString, DeliveryStateUpdate>;
+
+Q_DECLARE_METATYPE(DeliveryStateUpdates)
@@ -30,6 +30,8 @@
 
 #include "MessageDb.h"
 
+#include <chrono>
+
 // Qt
 #include <QSqlDatabase>
 #include <QSqlDriver>
@@ -37,20 +39,40 @@
 #include <QSqlQuery>
 #include <QSqlRecord>
 #include <QStringBuilder>
+#include <QTimer>
 // Kaidan
 #include "Globals.h"
 #include "Utils.h"
 
 #define CHECK_MESSAGE_EXISTS_DEPTH_LIMIT "20"
 
+using namespace std::chrono_literals;
+
+// Time in which added messages are collected before they are passed to the models (one
+// frame at 60 Hz)
+constexpr auto ADDED_MESSAGES_INTERVAL = 16ms;
+
+// Number of collected added messages after which they are passed to the models
+// immediately
+constexpr int ADDED_MESSAGES_MAX_COUNT = 500;
+
+// Number of messages updated by one query (limited by SQLite's maximum number of bound
+// variables per query)
+constexpr int DELIVERY_STATE_UPDATE_BATCH_SIZE = 150;
+
 MessageDb *MessageDb::s_instance = nullptr;
 
 MessageDb::MessageDb(QObject *parent)
-        : QObject(parent)
+        : QObject(parent),
+          m_addedMessagesTimer(new QTimer(this))
 {
 	Q_ASSERT(!MessageDb::s_instance);
 	s_instance = this;
 
+	m_addedMessagesTimer->setSingleShot(true);
+	m_addedMessagesTimer->setInterval(ADDED_MESSAGES_INTERVAL);
+	m_addedMessagesTimer->callOnTimeout(this, &MessageDb::emitAddedMessages);
+
 	connect(this, &MessageDb::fetchMessagesRequested,
 	        this, &MessageDb::fetchMessages);
 
@@ -58,6 +80,11 @@ MessageDb::MessageDb(QObject *parent)
 	        this, &MessageDb::fetchPendingMessages);
 
 	connect(this, &MessageDb::fetchLastMessageStampRequested, this, &MessageDb::fetchLastMessageStamp);
+	connect(this, &MessageDb::fetchMamSyncStateRequested, this, &MessageDb::fetchMamSyncState);
+	connect(this, &MessageDb::updateMamSyncStateRequested, this, &MessageDb::updateMamSyncState);
+
+	connect(this, &MessageDb::updateMessagesDeliveryStateRequested,
+	        this, &MessageDb::updateMessagesDeliveryState);
 }
 
 MessageDb::~MessageDb()
@@ -261,6 +288,34 @@ void MessageDb::fetchLastMessageStamp()
 	emit lastMessageStampFetched(stamp);
 }
 
+void MessageDb::fetchMamSyncState(const QString &accountJid)
+{
+	QSqlQuery query(QSqlDatabase::database(DB_CONNECTION));
+	query.setForwardOnly(true);
+
+	Utils::execQuery(
+		query,
+		"SELECT lastStanzaId FROM " DB_TABLE_MAM_SYNC_STATE " WHERE accountJid = ?",
+		QVector<QVariant>() << accountJid
+	);
+
+	QString lastStanzaId;
+	if (query.next())
+		lastStanzaId = query.value(0).toString();
+
+	emit mamSyncStateFetched(lastStanzaId);
+}
+
+void MessageDb::updateMamSyncState(const QString &accountJid, const QString &lastStanzaId)
+{
+	QSqlQuery query(QSqlDatabase::database(DB_CONNECTION));
+	Utils::execQuery(
+		query,
+		"INSERT OR REPLACE INTO " DB_TABLE_MAM_SYNC_STATE " (accountJid, lastStanzaId) VALUES (?, ?)",
+		QVector<QVariant>() << accountJid << lastStanzaId
+	);
+}
+
 void MessageDb::addMessage(const Message &msg, MessageOrigin origin)
 {
 	// deduplication
@@ -269,7 +324,7 @@ void MessageDb::addMessage(const Message &msg, MessageOrigin origin)
 	case MessageOrigin::MamCatchUp:
 	case MessageOrigin::Stream:
 		if (checkMessageExists(msg)) {
-			// message deduplicated (messageAdded() signal is not emitted)
+			// message deduplicated (it is not passed to the models)
 			return;
 		}
 		break;
@@ -279,8 +334,14 @@ void MessageDb::addMessage(const Message &msg, MessageOrigin origin)
 		break;
 	}
 
-	// to speed up the whole process emit signal first and do the actual insert after that
-	emit messageAdded(msg, origin);
+	// to speed up the whole process pass the message to the models first and do the
+	// actual insert after that
+	m_addedMessages.append({ msg, origin });
+
+	if (m_addedMessages.size() >= ADDED_MESSAGES_MAX_COUNT)
+		emitAddedMessages();
+	else if (!m_addedMessagesTimer->isActive())
+		m_addedMessagesTimer->start();
 
 	QSqlDatabase db = QSqlDatabase::database(DB_CONNECTION);
 
@@ -316,8 +377,12 @@ void MessageDb::addMessage(const Message &msg, MessageOrigin origin)
 
 void MessageDb::removeMessages(const QString &, const QString &)
 {
+	m_addedMessagesTimer->stop();
+	m_addedMessages.clear();
+
 	QSqlQuery query(QSqlDatabase::database(DB_CONNECTION));
 	Utils::execQuery(query, "DELETE FROM " DB_TABLE_MESSAGES);
+	Utils::execQuery(query, "DELETE FROM " DB_TABLE_MAM_SYNC_STATE);
 }
 
 void MessageDb::updateMessage(const QString &id,
@@ -361,6 +426,41 @@ void MessageDb::updateMessage(const QString &id,
 	}
 }
 
+void MessageDb::updateMessagesDeliveryState(const DeliveryStateUpdates &updates)
+{
+	QSqlQuery query(QSqlDatabase::database(DB_CONNECTION));
+
+	auto itr = updates.cbegin();
+	while (itr != updates.cend()) {
+		QString deliveryStateCases;
+		QString errorTextCases;
+		QStringList idPlaceholders;
+		QVector<QVariant> deliveryStateBindValues;
+		QVector<QVariant> errorTextBindValues;
+		QVector<QVariant> idBindValues;
+
+		for (int i = 0; i < DELIVERY_STATE_UPDATE_BATCH_SIZE && itr != updates.cend(); i++, itr++) {
+			deliveryStateCases += QStringLiteral("WHEN ? THEN ? ");
+			deliveryStateBindValues << itr.key() << int(itr->deliveryState);
+
+			errorTextCases += QStringLiteral("WHEN ? THEN ? ");
+			errorTextBindValues << itr.key() << itr->errorText;
+
+			idPlaceholders << QStringLiteral("?");
+			idBindValues << itr.key();
+		}
+
+		Utils::execQuery(
+			query,
+			QStringLiteral("UPDATE " DB_TABLE_MESSAGES " SET "
+			               "deliveryState = CASE id ") % deliveryStateCases % QStringLiteral("END, "
+			               "errorText = CASE id ") % errorTextCases % QStringLiteral("END "
+			               "WHERE id IN (") % idPlaceholders.join(u", ") % QStringLiteral(")"),
+			deliveryStateBindValues + errorTextBindValues + idBindValues
+		);
+	}
+}
+
 void MessageDb::updateMessageRecord(const QString &id,
                                     const QSqlRecord &updateRecord)
 {
@@ -426,26 +526,45 @@ bool MessageDb::checkMessageExists(const Message &message)
 	return count > 0;
 }
 
-void MessageDb::fetchPendingMessages(const QString& userJid)
+void MessageDb::fetchPendingMessages(const QString& userJid, qint64 lastRowId, int limit)
 {
+	// The query is not forward-only so that the last row can be read again after
+	// parsing the messages.
 	QSqlQuery query(QSqlDatabase::database(DB_CONNECTION));
-	query.setForwardOnly(true);
 
 	QMap<QString, QVariant> bindValues;
 	bindValues[":user"] = userJid;
 	bindValues[":deliveryState"] = int(Enums::DeliveryState::Pending);
+	bindValues[":lastRowId"] = lastRowId;
+	bindValues[":limit"] = limit;
 
+	// The row IDs reflect the order in which the messages were added and allow to
+	// continue right after the last fetched message.
 	Utils::execQuery(
 		query,
-		"SELECT * FROM " DB_TABLE_MESSAGES " "
-		"WHERE (author = :user AND deliveryState = :deliveryState) "
-		"ORDER BY timestamp ASC",
+		"SELECT rowid, * FROM " DB_TABLE_MESSAGES " "
+		"WHERE (author = :user AND deliveryState = :deliveryState AND rowid > :lastRowId) "
+		"ORDER BY rowid ASC "
+		"LIMIT :limit",
 		bindValues
 	);
 
 	QVector<Message> messages;
 	parseMessagesFromQuery(query, messages);
 
-	emit pendingMessagesFetched(messages);
+	if (!messages.isEmpty() && query.last())
+		lastRowId = query.value(0).toLongLong();
+
+	emit pendingMessagesFetched(messages, lastRowId);
 }
 
+void MessageDb::emitAddedMessages()
+{
+	m_addedMessagesTimer->stop();
+
+	if (m_addedMessages.isEmpty())
+		return;
+
+	emit messagesAdded(m_addedMessages);
+	m_addedMessages.clear();
+}
@@ -36,6 +36,7 @@
 
 class QSqlQuery;
 class QSqlRecord;
+class QTimer;
 
 /**
  * @class The MessageDb is used to query the 'messages' database table. It's used by the
@@ -79,10 +80,13 @@ signals:
 	/**
 	 *  Emitted to fetch pending messages.
 	 */
-	void fetchPendingMessagesRequested(const QString &userJid);
+	void fetchPendingMessagesRequested(const QString &userJid, qint64 lastRowId, int limit);
 	void fetchLastMessageStampRequested();
+	void fetchMamSyncStateRequested(const QString &accountJid);
+	void updateMamSyncStateRequested(const QString &accountJid, const QString &lastStanzaId);
 
 	void updateMessageRequested(const QString &id, const std::function<void (Message &)> &updateMsg);
+	void updateMessagesDeliveryStateRequested(const DeliveryStateUpdates &updates);
 	void removeAllMessagesRequested();
 
 	/**
@@ -92,15 +96,34 @@ signals:
 
 	/**
 	 * Emitted when pending messages have been fetched
+	 *
+	 * @param messages fetched messages
+	 * @param lastRowId row ID of the last fetched message used to fetch the next ones
 	 */
-	void pendingMessagesFetched(const QVector<Message> &messages);
+	void pendingMessagesFetched(const QVector<Message> &messages, qint64 lastRowId);
 
 	/**
 	 * Emitted when the latest message stamp was fetched
 	 */
 	void lastMessageStampFetched(const QDateTime &stamp);
 
-	void messageAdded(const Message &msg, MessageOrigin origin);
+	/**
+	 * Emitted when the MAM sync state of an account was fetched
+	 *
+	 * @param lastStanzaId ID of the last message retrieved from the archive or an empty
+	 * string if there is no sync state yet
+	 */
+	void mamSyncStateFetched(const QString &lastStanzaId);
+
+	/**
+	 * Emitted when messages were added to the database.
+	 *
+	 * Added messages are collected for one frame so that the models are updated at most
+	 * once per frame even if many messages are added (e.g. while catching up).
+	 *
+	 * @param messages added messages in the order they were added
+	 */
+	void messagesAdded(const QVector<AddedMessage> &messages);
 
 public slots:
 	/**
@@ -116,11 +139,14 @@ public slots:
 	                   int index);
 
 	/**
-	 * @brief Fetches messages that are marked as pending.
+	 * @brief Fetches messages that are marked as pending in the order they were added.
 	 *
 	 * @param userJid JID of the user whose messages should be fetched
+	 * @param lastRowId row ID of the last message fetched before or 0 to start with the
+	 * first pending message
+	 * @param limit maximum number of messages to be fetched
 	 */
-	void fetchPendingMessages(const QString &userJid);
+	void fetchPendingMessages(const QString &userJid, qint64 lastRowId, int limit);
 
 	/**
 	 * Fetches the last message and returns it.
@@ -132,6 +158,21 @@ public slots:
 	 */
 	void fetchLastMessageStamp();
 
+	/**
+	 * Fetches the MAM sync state of an account and emits mamSyncStateFetched().
+	 *
+	 * @param accountJid JID of the account
+	 */
+	void fetchMamSyncState(const QString &accountJid);
+
+	/**
+	 * Stores the MAM sync state of an account.
+	 *
+	 * @param accountJid JID of the account
+	 * @param lastStanzaId ID of the last message retrieved from the archive
+	 */
+	void updateMamSyncState(const QString &accountJid, const QString &lastStanzaId);
+
 	/**
 	 * Adds a message to the database.
 	 */
@@ -153,6 +194,13 @@ public slots:
 	void updateMessage(const QString &id,
 			   const std::function<void (Message &)> &updateMsg);
 
+	/**
+	 * Updates the delivery states and error texts of multiple messages at once.
+	 *
+	 * @param updates delivery state changes mapped to the IDs of their messages
+	 */
+	void updateMessagesDeliveryState(const DeliveryStateUpdates &updates);
+
 	/**
 	 * Updates message by @c UPDATE record: This means it doesn't load the message
 	 * from the database and writes it again, but executes an UPDATE query.
@@ -169,5 +217,13 @@ private slots:
 	bool checkMessageExists(const Message &message);
 
 private:
+	/**
+	 * Emits all collected added messages.
+	 */
+	void emitAddedMessages();
+
+	QTimer *m_addedMessagesTimer;
+	QVector<AddedMessage> m_addedMessages;
+
 	static MessageDb *s_instance;
 };
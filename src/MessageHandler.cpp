@@ -30,31 +30,78 @@
 
 #include "MessageHandler.h"
 // Qt
+#include <QDebug>
+#include <QDeadlineTimer>
+#include <QSet>
+#include <QTimer>
 #include <QUrl>
 // QXmpp
 #include <QXmppCarbonManager.h>
-#include <QXmppDiscoveryManager.h>
+#include <QXmppDiscoveryIq.h>
 #include <QXmppRosterManager.h>
 #include <QXmppUtils.h>
 // Kaidan
+#include "AccountManager.h"
 #include "ClientWorker.h"
 #include "Globals.h"
 #include "Kaidan.h"
 #include "Database.h"
+#include "DeliveryStateAggregator.h"
+#include "MamQueryScheduler.h"
+#include "MamQueryWatcher.h"
 #include "Message.h"
 #include "MessageDb.h"
 #include "MessageModel.h"
+#include "MessageOutbox.h"
 #include "MediaUtils.h"
+#include "QmlUtils.h"
+#include "RosterModel.h"
+#include "RosterVersioningExtension.h"
+#include "StreamTracker.h"
+
+#include <chrono>
+
+using namespace std::chrono_literals;
 
 // Number of messages fetched at once when loading MAM backlog
 constexpr int MAM_BACKLOG_FETCH_COUNT = 40;
 
+// Number of queries retrieving initial messages running at once
+constexpr int MAM_INITIAL_MAX_RUNNING_QUERIES = 8;
+
+// Number of finished queries retrieving initial messages after which the messages
+// received so far are committed to the database
+constexpr int MAM_INITIAL_COMMIT_INTERVAL = 25;
+
+// Numbers of messages fetched at once when catching up missed messages
+constexpr int MAM_CATCH_UP_FETCH_COUNT_MIN = 25;
+constexpr int MAM_CATCH_UP_FETCH_COUNT_DEFAULT = 100;
+constexpr int MAM_CATCH_UP_FETCH_COUNT_MAX = 800;
+
+// Time after which a changed sync state is stored
+constexpr auto MAM_SYNC_STATE_STORE_DELAY = 10s;
+
+// Durations for retrieving one catch-up page below / above which the number of messages
+// fetched at once is increased / decreased
+constexpr auto MAM_CATCH_UP_PAGE_DURATION_LOWER_BOUND = 1s;
+constexpr auto MAM_CATCH_UP_PAGE_DURATION_UPPER_BOUND = 4s;
+
 MessageHandler::MessageHandler(ClientWorker *clientWorker, QXmppClient *client, QObject *parent)
 	: QObject(parent),
 	  m_clientWorker(clientWorker),
 	  m_client(client),
 	  m_carbonManager(new QXmppCarbonManager),
-	  m_mamManager(new QXmppMamManager)
+	  m_mamManager(new QXmppMamManager),
+	  m_deliveryStateAggregator(new DeliveryStateAggregator(this)),
+	  m_outbox(new MessageOutbox(client, [client](const Message &message) {
+		  return client->sendPacket(message);
+	  }, clientWorker->streamTracker(), m_deliveryStateAggregator, this)),
+	  m_mamSyncStateStoreTimer(new QTimer(this)),
+	  m_initialMessagesScheduler(new MamQueryScheduler([this](const QString &jid) {
+		  return retrieveInitialMessage(jid);
+	  }, this)),
+	  m_catchUpQueryWatcher(new MamQueryWatcher),
+	  m_catchUpPageSize(MAM_CATCH_UP_FETCH_COUNT_DEFAULT)
 {
 	connect(client, &QXmppClient::messageReceived, this, [=](const QXmppMessage &msg) {
 		handleMessage(msg, MessageOrigin::Stream);
@@ -62,22 +109,45 @@ MessageHandler::MessageHandler(ClientWorker *clientWorker, QXmppClient *client,
 	connect(this, &MessageHandler::sendMessageRequested, this, &MessageHandler::sendMessage);
 	connect(MessageModel::instance(), &MessageModel::sendCorrectedMessageRequested,
 	        this, &MessageHandler::sendCorrectedMessage);
-	connect(MessageModel::instance(), &MessageModel::sendChatStateRequested,
-	        this, &MessageHandler::sendChatState);
+	connect(MessageModel::instance(), &MessageModel::sendChatStatesRequested,
+	        this, &MessageHandler::sendChatStates);
+	connect(m_deliveryStateAggregator, &DeliveryStateAggregator::deliveryStatesChanged,
+	        MessageModel::instance(), &MessageModel::updateMessagesDeliveryStateRequested);
+
+	connect(m_outbox, &MessageOutbox::fetchPendingMessagesRequested, this, [](qint64 lastRowId, int limit) {
+		emit MessageDb::instance()->fetchPendingMessagesRequested(AccountManager::instance()->jid(), lastRowId, limit);
+	});
+	connect(MessageDb::instance(), &MessageDb::pendingMessagesFetched,
+	        m_outbox, &MessageOutbox::handlePendingMessagesFetched);
+	connect(m_outbox, &MessageOutbox::sendingFailed, this, [this](const QString &id) {
+		// The error message of the message is saved untranslated. To make
+		// translation work in the UI, the tr() call of the passive
+		// notification must contain exactly the same string.
+		emit Kaidan::instance()->passiveNotificationRequested(tr("Message could not be sent."));
+		m_deliveryStateAggregator->setDeliveryState(id, Enums::DeliveryState::Error, QStringLiteral("Message could not be sent."));
+	});
 
 	connect(client, &QXmppClient::connected, this, &MessageHandler::handleConnected);
+	connect(client, &QXmppClient::stateChanged, this, [this](QXmppClient::State state) {
+		// Get the sync state to retrieve all new messages from the server since then.
+		// The account's JID is only known once connecting.
+		if (state == QXmppClient::ConnectingState && !m_isMamSyncStateRequested) {
+			m_isMamSyncStateRequested = true;
+			emit MessageDb::instance()->fetchMamSyncStateRequested(AccountManager::instance()->jid());
+		}
+	});
 	connect(client, &QXmppClient::disconnected, this, &MessageHandler::handleDisonnected);
-	connect(client->findExtension<QXmppRosterManager>(), &QXmppRosterManager::rosterReceived,
+	connect(client->findExtension<RosterVersioningExtension>(), &RosterVersioningExtension::rosterReceived,
 	        this, &MessageHandler::handleRosterReceived);
 	connect(MessageDb::instance(), &MessageDb::lastMessageStampFetched,
 	        this, &MessageHandler::handleLastMessageStampFetched);
+	connect(MessageDb::instance(), &MessageDb::mamSyncStateFetched,
+	        this, &MessageHandler::handleMamSyncStateFetched);
 
 	connect(&m_receiptManager, &QXmppMessageReceiptManager::messageDelivered,
 		this, [=](const QString &, const QString &id) {
-		emit MessageModel::instance()->updateMessageRequested(id, [](Message &msg) {
-			msg.setDeliveryState(Enums::DeliveryState::Delivered);
-			msg.setErrorText({});
-		});
+		m_deliveryStateAggregator->setDeliveryState(id, Enums::DeliveryState::Delivered);
+		m_outbox->handleMessageDelivered(id);
 	});
 
 	// messages sent to our account (forwarded from another client)
@@ -89,41 +159,70 @@ MessageHandler::MessageHandler(ClientWorker *clientWorker, QXmppClient *client,
 
 	connect(m_mamManager, &QXmppMamManager::archivedMessageReceived, this, &MessageHandler::handleArchiveMessage);
 	connect(m_mamManager, &QXmppMamManager::resultsRecieved, this, &MessageHandler::handleArchiveResults);
+	connect(m_catchUpQueryWatcher, &MamQueryWatcher::queryFailed, this, &MessageHandler::handleCatchUpQueryFailed);
+
+	m_initialMessagesScheduler->setMaxRunningQueries(MAM_INITIAL_MAX_RUNNING_QUERIES);
+	connect(m_initialMessagesScheduler, &MamQueryScheduler::progressChanged,
+	        this, &MessageHandler::handleInitialMessagesProgress);
+	connect(m_initialMessagesScheduler, &MamQueryScheduler::allQueriesFinished, this, [this]() {
+		emit Kaidan::instance()->database()->commitRequested();
+
+		// so this won't be triggered again on reconnect
+		m_lastMessageStamp = QDateTime::currentDateTimeUtc();
+		m_isMamSyncStateUpToDate = true;
+	});
+	// retrieve the initial message of the opened chat first
+	connect(MessageModel::instance(), &MessageModel::currentChatJidChanged,
+	        m_initialMessagesScheduler, &MamQueryScheduler::prioritize);
 
 	connect(this, &MessageHandler::retrieveBacklogMessagesRequested, this, &MessageHandler::retrieveBacklogMessages);
 
+	m_mamSyncStateStoreTimer->setSingleShot(true);
+	m_mamSyncStateStoreTimer->setInterval(MAM_SYNC_STATE_STORE_DELAY);
+	m_mamSyncStateStoreTimer->callOnTimeout(this, &MessageHandler::storeMamSyncState);
+
 	client->addExtension(&m_receiptManager);
 	client->addExtension(m_carbonManager);
 	client->addExtension(m_mamManager);
-
-	// carbons discovery
-	auto *discoveryManager = client->findExtension<QXmppDiscoveryManager>();
-	if (!discoveryManager)
-		return;
-
-	connect(discoveryManager, &QXmppDiscoveryManager::infoReceived,
-	        this, &MessageHandler::handleDiscoInfo);
-
-	connect(MessageModel::instance(), &MessageModel::pendingMessagesFetched,
-			this, &MessageHandler::handlePendingMessages);
-
-	// get last message stamp to retrieve all new messages from the server since then
-	emit MessageDb::instance()->fetchLastMessageStampRequested();
+	client->addExtension(m_catchUpQueryWatcher);
 }
 
 MessageHandler::~MessageHandler()
 {
 	delete m_carbonManager;
 	delete m_mamManager;
+	delete m_catchUpQueryWatcher;
+}
+
+void MessageHandler::sendPendingMessages()
+{
+	m_outbox->sendPendingMessages();
 }
 
 void MessageHandler::handleRosterReceived()
 {
 	// retrieve initial messages for each contact, if there is no last message locally
-	if (m_lastMessageLoaded && m_lastMessageStamp.isNull())
+	if (m_lastMessageLoaded && m_lastStanzaId.isEmpty() && m_lastMessageStamp.isNull())
 		retrieveInitialMessages();
 }
 
+void MessageHandler::handleMamSyncStateFetched(const QString &lastStanzaId)
+{
+	// Without a sync state (e.g., if it was not stored by an older version), the stamp of
+	// the last message is used instead.
+	if (lastStanzaId.isEmpty()) {
+		emit MessageDb::instance()->fetchLastMessageStampRequested();
+		return;
+	}
+
+	m_lastStanzaId = lastStanzaId;
+	m_lastMessageLoaded = true;
+
+	// if already connected directly retrieve missed messages
+	if (m_client->isConnected())
+		retrieveCatchUpMessages();
+}
+
 void MessageHandler::handleLastMessageStampFetched(const QDateTime &stamp)
 {
 	m_lastMessageStamp = stamp;
@@ -138,10 +237,10 @@ void MessageHandler::handleLastMessageStampFetched(const QDateTime &stamp)
 		// otherwise load all missed messages since last online.
 		if (stamp.isNull()) {
 			// only start if roster was received already
-			if (m_client->findExtension<QXmppRosterManager>()->isRosterReceived())
+			if (m_client->findExtension<RosterVersioningExtension>()->isRosterReceived())
 				retrieveInitialMessages();
 		} else {
-			retrieveCatchUpMessages(stamp);
+			retrieveCatchUpMessages();
 		}
 	}
 }
@@ -149,13 +248,17 @@ void MessageHandler::handleLastMessageStampFetched(const QDateTime &stamp)
 void MessageHandler::handleMessage(const QXmppMessage &msg, MessageOrigin origin)
 {
 	if (msg.type() == QXmppMessage::Error) {
-		emit MessageModel::instance()->updateMessageRequested(msg.id(), [errorText { msg.error().text() }](Message &msg) {
-			msg.setDeliveryState(Enums::DeliveryState::Error);
-			msg.setErrorText(errorText);
-		});
+		m_deliveryStateAggregator->setDeliveryState(msg.id(), Enums::DeliveryState::Error, msg.error().text());
 		return;
 	}
 
+	// Messages from the stream are only used as the new sync state if there are no
+	// older missed messages left in the archive.
+	if (origin == MessageOrigin::Stream && m_isMamSyncStateUpToDate
+	    && !msg.stanzaId().isEmpty() && msg.stanzaIdBy() == m_client->configuration().jidBare()) {
+		updateMamSyncState(msg.stanzaId());
+	}
+
 	if (msg.state() != QXmppMessage::State::None) {
 		emit MessageModel::instance()->handleChatStateRequested(
 				QXmppUtils::jidToBareJid(msg.from()), msg.state());
@@ -165,6 +268,7 @@ void MessageHandler::handleMessage(const QXmppMessage &msg, MessageOrigin origin
 		return;
 
 	Message message;
+	message.setReceptionTime(QDeadlineTimer::current().deadline());
 	message.setFrom(QXmppUtils::jidToBareJid(msg.from()));
 	message.setTo(QXmppUtils::jidToBareJid(msg.to()));
 	message.setIsOwn(QXmppUtils::jidToBareJid(msg.from()) == m_client->configuration().jidBare());
@@ -179,11 +283,15 @@ void MessageHandler::handleMessage(const QXmppMessage &msg, MessageOrigin origin
 	message.setStanzaId(msg.stanzaId());
 	message.setOriginId(msg.originId());
 
+	// The body is only searched once for links which are used for displaying it and for
+	// detecting media.
+	const auto uris = MediaUtils::findUris(message.body());
+	message.setFormattedBody(QmlUtils::formatMessage(message.body(), uris));
+
 	// check if message contains a link and also check out of band url
 	if (!parseMediaUri(message, msg.outOfBandUrl(), false)) {
-		const QStringList bodyWords = message.body().split(u' ');
-		for (const QString &word : bodyWords) {
-			if (parseMediaUri(message, word, true))
+		for (const auto &uri : uris) {
+			if (parseMediaUri(message, uri.url, true))
 				break;
 		}
 	}
@@ -213,6 +321,7 @@ void MessageHandler::sendMessage(const QString& toJid,
                                  const QString& spoilerHint)
 {
 	Message msg;
+	msg.setReceptionTime(QDeadlineTimer::current().deadline());
 	msg.setFrom(m_client->configuration().jidBare());
 	msg.setTo(toJid);
 	msg.setBody(body);
@@ -227,22 +336,25 @@ void MessageHandler::sendMessage(const QString& toJid,
 	msg.setSpoilerHint(spoilerHint);
 
 	// process links from the body
-	const QStringList words = body.split(u' ');
-	for (const auto &word : words) {
-		if (parseMediaUri(msg, word, true))
+	const auto uris = MediaUtils::findUris(body);
+	msg.setFormattedBody(QmlUtils::formatMessage(body, uris));
+	for (const auto &uri : uris) {
+		if (parseMediaUri(msg, uri.url, true))
 			break;
 	}
 
 	emit MessageModel::instance()->addMessageRequested(msg, MessageOrigin::UserInput);
-	sendPendingMessage(msg);
+	m_outbox->enqueue(msg);
 }
 
-void MessageHandler::sendChatState(const QString &toJid, const QXmppMessage::State state)
+void MessageHandler::sendChatStates(const ChatStates &states)
 {
-	QXmppMessage message;
-	message.setTo(toJid);
-	message.setState(state);
-	m_client->sendPacket(message);
+	for (auto itr = states.cbegin(); itr != states.cend(); ++itr) {
+		QXmppMessage message;
+		message.setTo(itr.key());
+		message.setState(itr.value());
+		m_client->sendPacket(message);
+	}
 }
 
 void MessageHandler::sendCorrectedMessage(const Message &msg)
@@ -257,10 +369,7 @@ void MessageHandler::sendCorrectedMessage(const Message &msg)
 		deliveryState = Enums::DeliveryState::Error;
 	}
 
-	emit MessageModel::instance()->updateMessageRequested(msg.id(), [=](Message &localMessage) {
-		localMessage.setDeliveryState(deliveryState);
-		localMessage.setErrorText(errorText);
-	});
+	m_deliveryStateAggregator->setDeliveryState(msg.id(), deliveryState, errorText);
 }
 
 void MessageHandler::handleDiscoInfo(const QXmppDiscoveryIq &info)
@@ -274,9 +383,20 @@ void MessageHandler::handleDiscoInfo(const QXmppDiscoveryIq &info)
 
 void MessageHandler::handleConnected()
 {
-	// retrieve missed messages, if the last saved message has been loaded and exists
-	if (m_lastMessageLoaded && !m_lastMessageStamp.isNull()) {
-		retrieveCatchUpMessages(m_lastMessageStamp);
+	// After resuming the stream, the server delivers all messages received in the
+	// meantime. Thus, no catch-up is needed if the sync state was up to date before.
+	if (m_clientWorker->streamTracker()->isStreamResumed()) {
+		if (m_isMamSyncStateUpToDate)
+			return;
+	} else {
+		// Messages received while being disconnected are not in the sync state until
+		// the next catch-up is finished.
+		m_isMamSyncStateUpToDate = false;
+	}
+
+	// retrieve missed messages, if the sync state has been loaded and exists
+	if (m_lastMessageLoaded && (!m_lastStanzaId.isEmpty() || !m_lastMessageStamp.isNull())) {
+		retrieveCatchUpMessages();
 	}
 }
 
@@ -291,46 +411,19 @@ void MessageHandler::handleDisonnected()
 	});
 	m_runningBacklogQueryIds.clear();
 
-	m_runningInitialMessageQueryIds.clear();
-	m_runnningCatchUpQueryId.clear();
-}
+	storeMamSyncState();
 
-void MessageHandler::sendPendingMessage(const Message &message)
-{
-	if (m_client->state() == QXmppClient::ConnectedState) {
-		bool success;
-		// if the message is a pending edition of the existing in the history message
-		// I need to send it with the most recent stamp
-		// for that I'm gonna copy that message and update in the copy just the stamp
-		if (message.isEdited()) {
-			Message msg = message;
-			msg.setStamp(QDateTime::currentDateTimeUtc());
-			success = m_client->sendPacket(msg);
-		} else {
-			success = m_client->sendPacket(message);
-		}
+	// Commit the messages received so far. The catch-up is continued after the last
+	// retrieved message after reconnecting.
+	if (!m_initialMessagesScheduler->isIdle()) {
+		m_initialMessagesScheduler->clear();
+		emit Kaidan::instance()->database()->commitRequested();
+	}
 
-		if (success) {
-			emit MessageModel::instance()->updateMessageRequested(message.id(), [](Message &msg) {
-				msg.setDeliveryState(Enums::DeliveryState::Sent);
-				msg.setErrorText({});
-			});
-		}
-		// TODO this "true" from sendPacket doesn't yet mean the message was successfully sent
-
-		else {
-			qWarning() << "[client] [MessageHandler] Could not send message, as a result of"
-				<< "QXmppClient::sendPacket returned false.";
-
-			// The error message of the message is saved untranslated. To make
-			// translation work in the UI, the tr() call of the passive
-			// notification must contain exactly the same string.
-			emit Kaidan::instance()->passiveNotificationRequested(tr("Message could not be sent."));
-			emit MessageModel::instance()->updateMessageRequested(message.id(), [](Message &msg) {
-				msg.setDeliveryState(Enums::DeliveryState::Error);
-				msg.setErrorText(QStringLiteral("Message could not be sent."));
-			});
-		}
+	if (!m_runnningCatchUpQueryId.isEmpty()) {
+		m_runnningCatchUpQueryId.clear();
+		m_catchUpQueryWatcher->finish();
+		emit Kaidan::instance()->database()->commitRequested();
 	}
 }
 
@@ -340,10 +433,14 @@ bool MessageHandler::parseMediaUri(Message &message, const QString &uri, bool is
 		return false;
 	}
 
+	return parseMediaUri(message, QUrl(uri), isBodyPart);
+}
+
+bool MessageHandler::parseMediaUri(Message &message, const QUrl &url, bool isBodyPart)
+{
 	// check message type by file name in link
 	// This is hacky, but needed without SIMS or an additional HTTP request.
 	// Also, this can be useful when a user manually posts an HTTP url.
-	const QUrl url(uri);
 	const QMimeType mimeType = MediaUtils::mimeType(url);
 	const MessageType messageType = MediaUtils::messageType(mimeType);
 
@@ -374,19 +471,12 @@ bool MessageHandler::parseMediaUri(Message &message, const QString &uri, bool is
 	return false;
 }
 
-void MessageHandler::handlePendingMessages(const QVector<Message> &messages)
-{
-	for (const Message &message : qAsConst(messages)) {
-		sendPendingMessage(message);
-	}
-}
-
 void MessageHandler::handleArchiveMessage(const QString &queryId,
                                           const QXmppMessage &message)
 {
 	if (queryId == m_runnningCatchUpQueryId) {
 		handleMessage(message, MessageOrigin::MamCatchUp);
-	} else if (m_runningInitialMessageQueryIds.contains(queryId)) {
+	} else if (m_initialMessagesScheduler->isQueryRunning(queryId)) {
 		// TODO: request other message if this message is empty (e.g. no body)
 		handleMessage(message, MessageOrigin::MamInitial);
 	} else if (m_runningBacklogQueryIds.contains(queryId)) {
@@ -400,27 +490,34 @@ void MessageHandler::handleArchiveMessage(const QString &queryId,
 }
 
 void MessageHandler::handleArchiveResults(const QString &queryId,
-                                          const QXmppResultSetReply &,
+                                          const QXmppResultSetReply &resultSetReply,
                                           bool complete)
 {
 	if (queryId == m_runnningCatchUpQueryId) {
 		m_runnningCatchUpQueryId.clear();
-		emit Kaidan::instance()->database()->commitRequested();
-		return;
-	}
+		m_catchUpQueryWatcher->finish();
+
+		// Store the last retrieved message together with the page so that even an
+		// interrupted catch-up is continued right after it.
+		if (!resultSetReply.last().isEmpty()) {
+			updateMamSyncState(resultSetReply.last());
+			storeMamSyncState();
+		}
 
-	if (m_runningInitialMessageQueryIds.contains(queryId)) {
-		m_runningInitialMessageQueryIds.removeOne(queryId);
+		emit Kaidan::instance()->database()->commitRequested();
 
-		if (m_runningInitialMessageQueryIds.isEmpty()) {
-			emit Kaidan::instance()->database()->commitRequested();
+		adaptCatchUpPageSize(m_catchUpPageTimer.elapsed());
 
-			// so this won't be triggered again on reconnect
-			m_lastMessageStamp = QDateTime::currentDateTimeUtc();
-		}
+		if (complete || resultSetReply.last().isEmpty())
+			m_isMamSyncStateUpToDate = true;
+		else
+			retrieveCatchUpMessagesPage();
 		return;
 	}
 
+	if (m_initialMessagesScheduler->finishQuery(queryId))
+		return;
+
 	if (m_runningBacklogQueryIds.contains(queryId)) {
 		const auto state = m_runningBacklogQueryIds.take(queryId);
 		emit MessageModel::instance()->mamBacklogRetrieved(m_client->configuration().jidBare(), state.chatJid, state.lastTimestamp, complete);
@@ -429,45 +526,158 @@ void MessageHandler::handleArchiveResults(const QString &queryId,
 
 void MessageHandler::retrieveInitialMessages()
 {
-	QXmppResultSetQuery queryLimit;
-	// load only one message per user (the rest can be loaded when needed)
-	queryLimit.setMax(1);
-	// query last (newest) first
-	queryLimit.setBefore("");
+	// only one retrieval can run at once
+	if (m_isInitialMessagesOrderRequested || !m_initialMessagesScheduler->isIdle())
+		return;
 
 	const auto bareJids = m_client->findExtension<QXmppRosterManager>()->getRosterBareJids();
 	if (bareJids.isEmpty()) {
 		return;
 	}
 
-	m_runningInitialMessageQueryIds.clear();
-	m_runningInitialMessageQueryIds.reserve(bareJids.size());
+	// The chats with the most recently exchanged messages are retrieved first. Those
+	// stamps are only known by the roster model living in the main thread.
+	m_isInitialMessagesOrderRequested = true;
+	QMetaObject::invokeMethod(RosterModel::instance(), [this, bareJids]() {
+		const auto jidsByLastExchanged = RosterModel::instance()->jidsByLastExchanged();
+		QMetaObject::invokeMethod(this, [this, bareJids, jidsByLastExchanged]() {
+			enqueueInitialMessageQueries(bareJids, jidsByLastExchanged);
+		});
+	});
+}
+
+void MessageHandler::enqueueInitialMessageQueries(const QStringList &bareJids, const QVector<QString> &jidsByLastExchanged)
+{
+	m_isInitialMessagesOrderRequested = false;
+
+	// The retrieval is started again after reconnecting.
+	if (!m_client->isConnected() || !m_initialMessagesScheduler->isIdle())
+		return;
 
+	emit Kaidan::instance()->database()->transactionRequested();
+
+	QSet<QString> remainingJids(bareJids.cbegin(), bareJids.cend());
+	for (const auto &jid : jidsByLastExchanged) {
+		if (remainingJids.remove(jid))
+			m_initialMessagesScheduler->enqueue(jid, MamQueryScheduler::NormalPriority);
+	}
+
+	// roster items not yet added to the roster model
 	for (const auto &jid : bareJids) {
-		m_runningInitialMessageQueryIds.push_back(m_mamManager->retrieveArchivedMessages(
-			QString(),
-			QString(),
-			jid,
-			QDateTime(),
-			QDateTime(),
-			queryLimit
-		));
+		if (remainingJids.contains(jid))
+			m_initialMessagesScheduler->enqueue(jid, MamQueryScheduler::LowPriority);
 	}
+}
 
-	emit Kaidan::instance()->database()->transactionRequested();
+QString MessageHandler::retrieveInitialMessage(const QString &jid)
+{
+	QXmppResultSetQuery queryLimit;
+	// load only one message per user (the rest can be loaded when needed)
+	queryLimit.setMax(1);
+	// query last (newest) first
+	queryLimit.setBefore("");
+
+	return m_mamManager->retrieveArchivedMessages({}, {}, jid, {}, {}, queryLimit);
+}
+
+void MessageHandler::handleInitialMessagesProgress(int finishedQueries, int totalQueries)
+{
+	// Commit the messages regularly instead of keeping the transaction open until the
+	// last query is finished.
+	if (finishedQueries > 0 && finishedQueries < totalQueries
+	    && finishedQueries % MAM_INITIAL_COMMIT_INTERVAL == 0) {
+		emit Kaidan::instance()->database()->commitRequested();
+		emit Kaidan::instance()->database()->transactionRequested();
+	}
 }
 
-void MessageHandler::retrieveCatchUpMessages(const QDateTime &stamp)
+void MessageHandler::retrieveCatchUpMessages()
+{
+	// only one catch-up can run at once
+	if (!m_runnningCatchUpQueryId.isEmpty())
+		return;
+
+	retrieveCatchUpMessagesPage();
+}
+
+void MessageHandler::retrieveCatchUpMessagesPage()
 {
 	QXmppResultSetQuery queryLimit;
-	// no limit
-	queryLimit.setMax(-1);
+	queryLimit.setMax(m_catchUpPageSize);
 
-	m_runnningCatchUpQueryId = m_mamManager->retrieveArchivedMessages({}, {}, {}, stamp, {}, queryLimit);
+	// Continue right after the last retrieved message. Only if it is unknown, start at the
+	// stamp of the last stored message.
+	QDateTime start;
+	if (m_lastStanzaId.isEmpty())
+		start = m_lastMessageStamp;
+	else
+		queryLimit.setAfter(m_lastStanzaId);
 
+	m_catchUpPageTimer.start();
+	m_runnningCatchUpQueryId = m_mamManager->retrieveArchivedMessages({}, {}, {}, start, {}, queryLimit);
+	m_catchUpQueryWatcher->watch(m_runnningCatchUpQueryId);
+
+	// each page is stored within its own transaction
 	emit Kaidan::instance()->database()->transactionRequested();
 }
 
+void MessageHandler::handleCatchUpQueryFailed(const QString &queryId)
+{
+	if (queryId != m_runnningCatchUpQueryId)
+		return;
+
+	m_runnningCatchUpQueryId.clear();
+	emit Kaidan::instance()->database()->commitRequested();
+
+	// Without a sync state, the catch-up is tried again after reconnecting.
+	if (m_lastStanzaId.isEmpty()) {
+		qWarning() << "[client] [MessageHandler] Catching up missed messages failed";
+		return;
+	}
+
+	// The archive may not know the last retrieved message anymore (e.g., if it was
+	// removed from the archive). Thus, the sync state is dropped and the catch-up is
+	// continued at the stamp of the last stored message.
+	qWarning() << "[client] [MessageHandler] Catching up missed messages after the last retrieved one failed,"
+	           << "continuing at the stamp of the last stored message";
+
+	updateMamSyncState({});
+	storeMamSyncState();
+
+	if (m_lastMessageStamp.isNull())
+		emit MessageDb::instance()->fetchLastMessageStampRequested();
+	else
+		retrieveCatchUpMessagesPage();
+}
+
+void MessageHandler::adaptCatchUpPageSize(qint64 pageDuration)
+{
+	if (pageDuration < std::chrono::milliseconds(MAM_CATCH_UP_PAGE_DURATION_LOWER_BOUND).count())
+		m_catchUpPageSize = std::min(m_catchUpPageSize * 2, MAM_CATCH_UP_FETCH_COUNT_MAX);
+	else if (pageDuration > std::chrono::milliseconds(MAM_CATCH_UP_PAGE_DURATION_UPPER_BOUND).count())
+		m_catchUpPageSize = std::max(m_catchUpPageSize / 2, MAM_CATCH_UP_FETCH_COUNT_MIN);
+}
+
+void MessageHandler::updateMamSyncState(const QString &lastStanzaId)
+{
+	m_lastStanzaId = lastStanzaId;
+	m_isMamSyncStateStored = false;
+
+	if (!m_mamSyncStateStoreTimer->isActive())
+		m_mamSyncStateStoreTimer->start();
+}
+
+void MessageHandler::storeMamSyncState()
+{
+	m_mamSyncStateStoreTimer->stop();
+
+	if (m_isMamSyncStateStored)
+		return;
+
+	m_isMamSyncStateStored = true;
+	emit MessageDb::instance()->updateMamSyncStateRequested(AccountManager::instance()->jid(), m_lastStanzaId);
+}
+
 void MessageHandler::retrieveBacklogMessages(const QString &jid, const QDateTime &stamp)
 {
 	QXmppResultSetQuery queryLimit;
@@ -31,16 +31,23 @@
 #pragma once
 
 // Qt
+#include <QElapsedTimer>
 #include <QObject>
+#include <QVector>
 // QXmpp
 #include <QXmppGlobal.h>
 #include <QXmppMamManager.h>
 #include <QXmppMessageReceiptManager.h>
 // Kaidan
+#include "ChatStateCoalescer.h"
 #include "Message.h"
 #include "Enums.h"
 
 class ClientWorker;
+class DeliveryStateAggregator;
+class MamQueryScheduler;
+class MamQueryWatcher;
+class MessageOutbox;
 class Kaidan;
 
 class QMimeType;
@@ -61,9 +68,15 @@ public:
 	MessageHandler(ClientWorker *clientWorker, QXmppClient *client, QObject *parent = nullptr);
 	~MessageHandler();
 
+	/**
+	 * Starts sending all messages that are pending in the database.
+	 */
+	void sendPendingMessages();
+
 public slots:
 	void handleRosterReceived();
 	void handleLastMessageStampFetched(const QDateTime &stamp);
+	void handleMamSyncStateFetched(const QString &lastStanzaId);
 
 	/**
 	 * Handles incoming messages from the server.
@@ -76,9 +89,9 @@ public slots:
 	void sendMessage(const QString &toJid, const QString &body, bool isSpoiler, const QString &spoilerHint);
 
 	/**
-	 * Sends a chat state notification to the server.
+	 * Sends chat state notifications to the server.
 	 */
-	void sendChatState(const QString &toJid, const QXmppMessage::State state);
+	void sendChatStates(const ChatStates &states);
 
 	/**
 	 * Sends the corrected version of a message.
@@ -102,24 +115,68 @@ private slots:
 	void handleConnected();
 	void handleDisonnected();
 
-	/**
-	 * Handles pending messages found in the database.
-	 */
-	void handlePendingMessages(const QVector<Message> &messages);
-
-	void sendPendingMessage(const Message &message);
-
 	void handleArchiveMessage(const QString &queryId, const QXmppMessage &message);
 	void handleArchiveResults(const QString &queryId,
 	                          const QXmppResultSetReply &resultSetReply,
 	                          bool complete);
 
 	void retrieveInitialMessages();
-	void retrieveCatchUpMessages(const QDateTime &stamp);
+	void retrieveCatchUpMessages();
+	void retrieveCatchUpMessagesPage();
+	void handleCatchUpQueryFailed(const QString &queryId);
 	void retrieveBacklogMessages(const QString &jid, const QDateTime &last);
 
 private:
 	bool parseMediaUri(Message &message, const QString &uri, bool isBodyPart);
+	bool parseMediaUri(Message &message, const QUrl &url, bool isBodyPart);
+
+	/**
+	 * Adapts the number of messages requested per catch-up page to the time the last
+	 * page needed to be retrieved.
+	 *
+	 * @param pageDuration time in milliseconds needed for retrieving the last page
+	 */
+	void adaptCatchUpPageSize(qint64 pageDuration);
+
+	/**
+	 * Sets the ID of the last message retrieved from the archive so that the next
+	 * catch-up is continued right after it.
+	 *
+	 * The ID is stored with a delay so that not each received message results in a
+	 * database write.
+	 *
+	 * @param lastStanzaId ID of the message assigned by the archive
+	 */
+	void updateMamSyncState(const QString &lastStanzaId);
+
+	/**
+	 * Stores the ID of the last message retrieved from the archive if it changed since
+	 * it was stored the last time.
+	 */
+	void storeMamSyncState();
+
+	/**
+	 * Starts the query retrieving the initial message of a chat.
+	 *
+	 * @param jid JID of the chat
+	 *
+	 * @return the ID of the query
+	 */
+	QString retrieveInitialMessage(const QString &jid);
+
+	/**
+	 * Enqueues the queries retrieving the initial messages of all chats.
+	 *
+	 * @param bareJids JIDs of all roster items
+	 * @param jidsByLastExchanged JIDs of the roster model's items ordered by their last
+	 * exchanged messages
+	 */
+	void enqueueInitialMessageQueries(const QStringList &bareJids, const QVector<QString> &jidsByLastExchanged);
+
+	/**
+	 * Handles the progress of retrieving the initial messages.
+	 */
+	void handleInitialMessagesProgress(int finishedQueries, int totalQueries);
 
 	struct BacklogQueryState {
 		QString chatJid;
@@ -131,14 +188,33 @@ private:
 	QXmppMessageReceiptManager m_receiptManager;
 	QXmppCarbonManager *m_carbonManager;
 	QXmppMamManager *m_mamManager;
+	DeliveryStateAggregator *m_deliveryStateAggregator;
+	MessageOutbox *m_outbox;
 
+	// stamp of the last message used for catching up if there is no sync state yet
 	QDateTime m_lastMessageStamp;
 	bool m_lastMessageLoaded = false;
-
-	// All messages after the intitial message
-	QVector<QString> m_runningInitialMessageQueryIds;
+	// ID of the last message retrieved from the archive
+	QString m_lastStanzaId;
+	// whether all messages up to the last one in the archive are retrieved
+	bool m_isMamSyncStateUpToDate = false;
+	// whether the sync state was requested from the database
+	bool m_isMamSyncStateRequested = false;
+	// whether m_lastStanzaId is stored in the database
+	bool m_isMamSyncStateStored = true;
+	QTimer *m_mamSyncStateStoreTimer;
+
+	// scheduler for the queries retrieving the initial message of each chat
+	MamQueryScheduler *m_initialMessagesScheduler;
+	// whether the order of the chats for retrieving the initial messages is being determined
+	bool m_isInitialMessagesOrderRequested = false;
 	// Mapping of all running MAM backlog queries to their chat JIDs
 	QMap<QString, BacklogQueryState> m_runningBacklogQueryIds;
 	// query id of the MAM query for catching up all missing messages
 	QString m_runnningCatchUpQueryId;
+	// watcher detecting a failure of the catch-up query
+	MamQueryWatcher *m_catchUpQueryWatcher;
+	// number of messages requested per catch-up page
+	int m_catchUpPageSize;
+	QElapsedTimer m_catchUpPageTimer;
 };
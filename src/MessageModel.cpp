@@ -33,13 +33,16 @@
 #include <chrono>
 
 // Qt
+#include <QDeadlineTimer>
 #include <QGuiApplication>
+#include <QSet>
 #include <QTimer>
 // QXmpp
 #include <QXmppUtils.h>
 // Kaidan
 #include "AccountManager.h"
 #include "Kaidan.h"
+#include "LoggingCategories.h"
 #include "MessageDb.h"
 #include "MessageHandler.h"
 #include "Notifications.h"
@@ -69,7 +72,8 @@ MessageModel::MessageModel(QObject *parent)
 	  m_composingTimer(new QTimer(this)),
 	  m_stateTimeoutTimer(new QTimer(this)),
 	  m_inactiveTimer(new QTimer(this)),
-	  m_chatPartnerChatStateTimeout(new QTimer(this))
+	  m_chatPartnerChatStateTimeout(new QTimer(this)),
+	  m_chatStateCoalescer(new ChatStateCoalescer(this))
 {
 	Q_ASSERT(!s_instance);
 	s_instance = this;
@@ -107,18 +111,21 @@ MessageModel::MessageModel(QObject *parent)
 		emit chatStateChanged();
 	});
 
+	connect(m_chatStateCoalescer, &ChatStateCoalescer::sendChatStatesRequested,
+	        this, &MessageModel::sendChatStatesRequested);
+
 	connect(MessageDb::instance(), &MessageDb::messagesFetched,
 	        this, &MessageModel::handleMessagesFetched);
-	connect(MessageDb::instance(), &MessageDb::pendingMessagesFetched,
-	        this, &MessageModel::pendingMessagesFetched);
 
 	// addMessage requests are forwarded to the MessageDb, are deduplicated there and
-	// added if MessageDb::messageAdded is emitted
+	// added if MessageDb::messagesAdded is emitted
 	connect(this, &MessageModel::addMessageRequested, MessageDb::instance(), &MessageDb::addMessage);
-	connect(MessageDb::instance(), &MessageDb::messageAdded, this, &MessageModel::handleMessage);
+	connect(MessageDb::instance(), &MessageDb::messagesAdded, this, &MessageModel::handleMessagesAdded);
 
 	connect(this, &MessageModel::updateMessageRequested,
 	        this, &MessageModel::updateMessage);
+	connect(this, &MessageModel::updateMessagesDeliveryStateRequested,
+	        this, &MessageModel::updateMessagesDeliveryState);
 	connect(this, &MessageModel::handleChatStateRequested,
 		this, &MessageModel::handleChatState);
 
@@ -163,6 +170,7 @@ QHash<int, QByteArray> MessageModel::roleNames() const
 	roles[ErrorText] = "errorText";
 	roles[DeliveryStateIcon] = "deliveryStateIcon";
 	roles[DeliveryStateName] = "deliveryStateName";
+	roles[FormattedBody] = "formattedBody";
 	return roles;
 }
 
@@ -185,6 +193,8 @@ QVariant MessageModel::data(const QModelIndex &index, int role) const
 		return msg.to();
 	case Body:
 		return msg.body();
+	case FormattedBody:
+		return msg.formattedBody();
 	case IsOwn:
 		return msg.isOwn();
 	case MediaType:
@@ -407,6 +417,21 @@ void MessageModel::insertMessage(int idx, const Message &msg)
 	endInsertRows();
 }
 
+void MessageModel::addMessages(const QVector<Message> &messages)
+{
+	// The common case of messages newer than all loaded ones results in only one
+	// insertion.
+	if (m_messages.isEmpty() || messages.last().stamp() > m_messages.first().stamp()) {
+		beginInsertRows(QModelIndex(), 0, messages.size() - 1);
+		m_messages = messages + m_messages;
+		endInsertRows();
+		return;
+	}
+
+	for (const auto &message : messages)
+		addMessage(message);
+}
+
 void MessageModel::addMessage(const Message &msg)
 {
 	// index where to add the new message
@@ -436,6 +461,12 @@ void MessageModel::updateMessage(const QString &id,
 			if (m_messages.at(i) == msg)
 				return;
 
+			// format a changed body if it is not already formatted
+			if (msg.body() != m_messages.at(i).body() && msg.formattedBody() == m_messages.at(i).formattedBody()) {
+				msg.setFormattedBody({});
+				processMessage(msg);
+			}
+
 			// check, if the position of the new message may be different
 			if (msg.stamp() == m_messages.at(i).stamp()) {
 				beginRemoveRows(QModelIndex(), i, i);
@@ -462,14 +493,83 @@ void MessageModel::updateMessage(const QString &id,
 	emit MessageDb::instance()->updateMessageRequested(id, updateMsg);
 }
 
-void MessageModel::handleMessage(Message msg, MessageOrigin origin)
+void MessageModel::updateMessagesDeliveryState(const DeliveryStateUpdates &updates)
 {
-	processMessage(msg);
+	// The delivery state does not affect the position of a message. Thus, the messages
+	// can be updated in place within one pass.
+	int processedUpdates = 0;
+	for (int i = 0; i < m_messages.size() && processedUpdates < updates.size(); i++) {
+		const auto itr = updates.constFind(m_messages.at(i).id());
+		if (itr == updates.cend())
+			continue;
 
-	showMessageNotification(msg, origin);
+		processedUpdates++;
 
-	if (msg.from() == m_currentChatJid || msg.to() == m_currentChatJid) {
-		addMessage(std::move(msg));
+		Message &msg = m_messages[i];
+		if (msg.deliveryState() == itr->deliveryState && msg.errorText() == itr->errorText)
+			continue;
+
+		msg.setDeliveryState(itr->deliveryState);
+		msg.setErrorText(itr->errorText);
+
+		const auto modelIndex = index(i);
+		emit dataChanged(modelIndex, modelIndex, {
+			DeliveryState,
+			DeliveryStateIcon,
+			DeliveryStateName,
+			ErrorText
+		});
+	}
+
+	emit MessageDb::instance()->updateMessagesDeliveryStateRequested(updates);
+}
+
+void MessageModel::handleMessagesAdded(const QVector<AddedMessage> &messages)
+{
+	QVector<Message> currentChatMessages;
+	qint64 latencySum = 0;
+	qint64 maxLatency = 0;
+	int measuredMessageCount = 0;
+	const auto currentTime = QDeadlineTimer::current().deadline();
+
+	for (const auto &addedMessage : messages) {
+		const auto &message = addedMessage.message;
+
+		if (message.receptionTime() > 0) {
+			const auto latency = currentTime - message.receptionTime();
+			latencySum += latency;
+			maxLatency = std::max(maxLatency, latency);
+			measuredMessageCount++;
+		}
+
+		if (message.from() == m_currentChatJid || message.to() == m_currentChatJid) {
+			currentChatMessages.append(message);
+			processMessage(currentChatMessages.last());
+		}
+	}
+
+	// Only the latest message of each chat is notified about.
+	QSet<QString> notifiedChatJids;
+	for (auto itr = messages.crbegin(); itr != messages.crend(); ++itr) {
+		if (itr->origin != MessageOrigin::Stream && itr->origin != MessageOrigin::MamCatchUp)
+			continue;
+
+		if (!notifiedChatJids.contains(itr->message.from())) {
+			notifiedChatJids.insert(itr->message.from());
+			showMessageNotification(itr->message, itr->origin);
+		}
+	}
+
+	if (!currentChatMessages.isEmpty()) {
+		std::stable_sort(currentChatMessages.begin(), currentChatMessages.end(), [](const Message &a, const Message &b) {
+			return a.stamp() > b.stamp();
+		});
+		addMessages(currentChatMessages);
+	}
+
+	if (measuredMessageCount > 0) {
+		qCDebug(KAIDAN_LATENCY_LOG) << "Applied" << messages.size() << "added messages with a latency of"
+		                            << latencySum / measuredMessageCount << "ms on average and" << maxLatency << "ms at most";
 	}
 }
 
@@ -509,12 +609,12 @@ void MessageModel::processMessage(Message &msg)
 		auto body = msg.body();
 		body.truncate(MESSAGE_MAX_CHARS);
 		msg.setBody(body);
+		msg.setFormattedBody({});
 	}
-}
 
-void MessageModel::sendPendingMessages()
-{
-	emit MessageDb::instance()->fetchPendingMessagesRequested(AccountManager::instance()->jid());
+	// Messages loaded from the database are formatted once when being added.
+	if (msg.formattedBody().isEmpty() && !msg.body().isEmpty())
+		msg.setFormattedBody(QmlUtils::formatMessage(msg.body()));
 }
 
 QXmppMessage::State MessageModel::chatState() const
@@ -543,7 +643,7 @@ void MessageModel::sendChatState(QXmppMessage::State state)
 	// Only send if the state changed, filter duplicated
 	if (state != m_ownChatState) {
 		m_ownChatState = state;
-		emit sendChatStateRequested(m_currentChatJid, state);
+		m_chatStateCoalescer->setChatState(m_currentChatJid, state);
 	}
 }
 
@@ -35,6 +35,7 @@
 // QXmpp
 #include <QXmppMessage.h>
 // Kaidan
+#include "ChatStateCoalescer.h"
 #include "Message.h"
 
 class QTimer;
@@ -89,7 +90,8 @@ public:
 		SpoilerHint,
 		ErrorText,
 		DeliveryStateIcon,
-		DeliveryStateName
+		DeliveryStateName,
+		FormattedBody
 	};
 	Q_ENUM(MessageRoles)
 
@@ -153,11 +155,6 @@ public:
 	 */
 	Q_INVOKABLE int searchForMessageFromOldToNew(const QString &searchString, const int startIndex = -1) const;
 
-	/**
-	 * Sends pending messages again after searching them in the database.
-	 */
-	Q_INVOKABLE void sendPendingMessages();
-
 	/**
 	  * Returns the current chat state
 	  */
@@ -180,10 +177,24 @@ signals:
 	void addMessageRequested(const Message &message, MessageOrigin origin);
 	void updateMessageRequested(const QString &id,
 	                            const std::function<void (Message &)> &updateMsg);
-	void pendingMessagesFetched(const QVector<Message> &messages);
+
+	/**
+	 * Emitted to apply a batch of delivery state changes.
+	 *
+	 * @param updates delivery state changes mapped to the IDs of their messages
+	 */
+	void updateMessagesDeliveryStateRequested(const DeliveryStateUpdates &updates);
+
 	void sendCorrectedMessageRequested(const Message &msg);
 	void chatStateChanged();
-	void sendChatStateRequested(const QString &bareJid, QXmppMessage::State state);
+
+	/**
+	 * Emitted to send a batch of the user's chat states.
+	 *
+	 * @param states chat states mapped to the bare JIDs of the chat partners
+	 */
+	void sendChatStatesRequested(const ChatStates &states);
+
 	void handleChatStateRequested(const QString &bareJid, QXmppMessage::State state);
 	void mamBacklogRetrieved(const QString &accountJid, const QString &jid, const QDateTime &lastStamp, bool complete);
 
@@ -203,7 +214,20 @@ private slots:
 	void updateMessage(const QString &id,
 	                   const std::function<void (Message &)> &updateMsg);
 
-	void handleMessage(Message msg, MessageOrigin origin);
+	/**
+	 * Applies a batch of delivery state changes to the loaded messages and stores them
+	 * in the database.
+	 *
+	 * @param updates delivery state changes mapped to the IDs of their messages
+	 */
+	void updateMessagesDeliveryState(const DeliveryStateUpdates &updates);
+
+	/**
+	 * Applies a batch of messages added to the database.
+	 *
+	 * @param messages added messages in the order they were added
+	 */
+	void handleMessagesAdded(const QVector<AddedMessage> &messages);
 	void handleChatState(const QString &bareJid, QXmppMessage::State state);
 
 private:
@@ -219,6 +243,13 @@ private:
 
 	void insertMessage(int i, const Message &msg);
 
+	/**
+	 * Adds messages of the current chat.
+	 *
+	 * @param messages messages sorted from the newest to the oldest one
+	 */
+	void addMessages(const QVector<Message> &messages);
+
 	/**
 	 * Shortens messages to 10000 if longer to prevent DoS
 	 * @param message to process
@@ -247,6 +278,7 @@ private:
 	QTimer *m_inactiveTimer;
 	QTimer *m_chatPartnerChatStateTimeout;
 	QMap<QString, QXmppMessage::State> m_chatStateCache;
+	ChatStateCoalescer *m_chatStateCoalescer;
 
 	static MessageModel *s_instance;
 };
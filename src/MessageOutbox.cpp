@@ -0,0 +1,223 @@
+/*
+ *  Kaidan - A user-friendly XMPP client for every device!
+ *
+ *  Copyright (C) 2016-2021 Kaidan developers and contributors
+ *  (see the LICENSE file for a full list of copyright authors)
+ *
+ *  Kaidan is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  In addition, as a special exception, the author of Kaidan gives
+ *  permission to link the code of its release with the OpenSSL
+ *  project's "OpenSSL" library (or with modified versions of it that
+ *  use the same license as the "OpenSSL" library), and distribute the
+ *  linked executables. You must obey the GNU General Public License in
+ *  all respects for all of the code used other than "OpenSSL". If you
+ *  modify this file, you may extend this exception to your version of
+ *  the file, but you are not obligated to do so.  If you do not wish to
+ *  do so, delete this exception statement from your version.
+ *
+ *  Kaidan is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Kaidan.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "MessageOutbox.h"
+
+#include <algorithm>
+
+// Qt
+#include <QDateTime>
+#include <QDebug>
+// QXmpp
+#include <QXmppClient.h>
+// Kaidan
+#include "DeliveryStateAggregator.h"
+#include "StreamTracker.h"
+
+// Number of messages that are sent without being acknowledged by the server
+constexpr int OUTBOX_MAX_UNACKNOWLEDGED_MESSAGES = 10;
+
+// Number of pending messages loaded from the database at once
+constexpr int OUTBOX_FETCH_COUNT = 50;
+
+MessageOutbox::MessageOutbox(QXmppClient *client, const MessageSender &messageSender, StreamTracker *streamTracker, DeliveryStateAggregator *deliveryStateAggregator, QObject *parent)
+	: QObject(parent),
+	  m_messageSender(messageSender),
+	  m_streamTracker(streamTracker),
+	  m_deliveryStateAggregator(deliveryStateAggregator)
+{
+	connect(client, &QXmppClient::disconnected, this, &MessageOutbox::handleDisconnected);
+	connect(streamTracker, &StreamTracker::acknowledged,
+	        this, &MessageOutbox::handleAcknowledgement);
+	connect(streamTracker, &StreamTracker::failed,
+	        this, &MessageOutbox::markUnacknowledgedMessagesAsSent);
+}
+
+MessageOutbox::~MessageOutbox() = default;
+
+void MessageOutbox::enqueue(const Message &message)
+{
+	// Without being connected, the message is loaded from the database later.
+	if (!m_isSendingEnabled)
+		return;
+
+	enqueueMessage(message);
+	drain();
+}
+
+void MessageOutbox::sendPendingMessages()
+{
+	m_isSendingEnabled = true;
+
+	// After resuming the stream, the server acknowledges the messages sent before the
+	// connection loss and QXmpp sends the unacknowledged ones again. Only the messages
+	// stored while being disconnected need to be fetched.
+	if (m_streamTracker->isStreamResumed()) {
+		m_hasMorePendingMessages = true;
+		if (!m_isFetchingPendingMessages)
+			fetchPendingMessages();
+		drain();
+		return;
+	}
+
+	m_queue.clear();
+	m_unacknowledgedMessages.clear();
+	m_knownMessageIds.clear();
+
+	// Results of requests made before the reset are ignored.
+	m_pendingMessagesFetchGeneration++;
+	m_isFetchingPendingMessages = false;
+
+	m_lastFetchedRowId = 0;
+	m_hasMorePendingMessages = true;
+	fetchPendingMessages();
+}
+
+void MessageOutbox::handleMessageDelivered(const QString &id)
+{
+	const auto itr = std::find_if(m_unacknowledgedMessages.begin(), m_unacknowledgedMessages.end(), [&id](const UnacknowledgedMessage &message) {
+		return message.id == id;
+	});
+
+	if (itr != m_unacknowledgedMessages.end()) {
+		m_unacknowledgedMessages.erase(itr);
+		drain();
+	}
+}
+
+void MessageOutbox::handlePendingMessagesFetched(const QVector<Message> &messages, qint64 lastRowId)
+{
+	// The database handles the requests in the order they were made.
+	if (m_pendingMessagesFetchGenerations.isEmpty())
+		return;
+
+	// The fetched messages are outdated if the queue was reset in the meantime.
+	if (m_pendingMessagesFetchGenerations.dequeue() != m_pendingMessagesFetchGeneration)
+		return;
+
+	m_isFetchingPendingMessages = false;
+	m_hasMorePendingMessages = messages.size() == OUTBOX_FETCH_COUNT;
+	m_lastFetchedRowId = lastRowId;
+
+	for (const auto &message : messages) {
+		// skip messages which were enqueued directly while fetching them
+		if (!m_knownMessageIds.contains(message.id()))
+			enqueueMessage(message);
+	}
+
+	drain();
+}
+
+void MessageOutbox::handleDisconnected()
+{
+	// The queue is kept in case the stream can be resumed. Otherwise, unacknowledged
+	// messages stay pending in the database and are sent again after the next login.
+	m_isSendingEnabled = false;
+}
+
+void MessageOutbox::drain()
+{
+	if (!m_isSendingEnabled)
+		return;
+
+	while (!m_queue.isEmpty() && m_unacknowledgedMessages.size() < OUTBOX_MAX_UNACKNOWLEDGED_MESSAGES) {
+		const auto queuedMessage = m_queue.dequeue();
+
+		if (!send(queuedMessage)) {
+			qWarning() << "[client] [MessageOutbox] Could not send message" << queuedMessage.sequenceNumber
+			           << "of the outbox, as a result of QXmppClient::sendPacket returned false.";
+
+			emit sendingFailed(queuedMessage.message.id());
+			continue;
+		}
+
+		if (m_streamTracker->isEnabled()) {
+			// The stanza was counted by the tracker while being sent.
+			m_unacknowledgedMessages.append({ queuedMessage.sequenceNumber, queuedMessage.message.id(), m_streamTracker->sentStanzas() });
+		} else {
+			m_deliveryStateAggregator->setDeliveryState(queuedMessage.message.id(), Enums::DeliveryState::Sent);
+		}
+	}
+
+	// load the next pending messages before the queue runs empty
+	if (m_queue.size() < OUTBOX_FETCH_COUNT / 2 && m_hasMorePendingMessages && !m_isFetchingPendingMessages)
+		fetchPendingMessages();
+}
+
+bool MessageOutbox::send(const QueuedMessage &queuedMessage)
+{
+	// A pending correction of a message is sent with the current stamp.
+	if (queuedMessage.message.isEdited()) {
+		Message message = queuedMessage.message;
+		message.setStamp(QDateTime::currentDateTimeUtc());
+		return m_messageSender(message);
+	}
+
+	return m_messageSender(queuedMessage.message);
+}
+
+void MessageOutbox::enqueueMessage(const Message &message)
+{
+	m_knownMessageIds.insert(message.id());
+	m_queue.enqueue({ m_nextSequenceNumber++, message });
+}
+
+void MessageOutbox::fetchPendingMessages()
+{
+	m_isFetchingPendingMessages = true;
+	m_pendingMessagesFetchGenerations.enqueue(m_pendingMessagesFetchGeneration);
+	emit fetchPendingMessagesRequested(m_lastFetchedRowId, OUTBOX_FETCH_COUNT);
+}
+
+void MessageOutbox::handleAcknowledgement(quint32 handledStanzas)
+{
+	const auto oldCount = m_unacknowledgedMessages.size();
+
+	// The counter wraps around at 2^32 (see XEP-0198).
+	m_unacknowledgedMessages.erase(std::remove_if(m_unacknowledgedMessages.begin(), m_unacknowledgedMessages.end(), [=](const UnacknowledgedMessage &message) {
+		if (qint32(handledStanzas - message.stanzaNumber) < 0)
+			return false;
+
+		m_deliveryStateAggregator->setDeliveryState(message.id, Enums::DeliveryState::Sent);
+		return true;
+	}), m_unacknowledgedMessages.end());
+
+	if (m_unacknowledgedMessages.size() != oldCount)
+		drain();
+}
+
+void MessageOutbox::markUnacknowledgedMessagesAsSent()
+{
+	for (const auto &message : qAsConst(m_unacknowledgedMessages))
+		m_deliveryStateAggregator->setDeliveryState(message.id, Enums::DeliveryState::Sent);
+
+	m_unacknowledgedMessages.clear();
+	drain();
+}
@@ -0,0 +1,188 @@
+/*
+ *  Kaidan - A user-friendly XMPP client for every device!
+ *
+ *  Copyright (C) 2016-2021 Kaidan developers and contributors
+ *  (see the LICENSE file for a full list of copyright authors)
+ *
+ *  Kaidan is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  In addition, as a special exception, the author of Kaidan gives
+ *  permission to link the code of its release with the OpenSSL
+ *  project's "OpenSSL" library (or with modified versions of it that
+ *  use the same license as the "OpenSSL" library), and distribute the
+ *  linked executables. You must obey the GNU General Public License in
+ *  all respects for all of the code used other than "OpenSSL". If you
+ *  modify this file, you may extend this exception to your version of
+ *  the file, but you are not obligated to do so.  If you do not wish to
+ *  do so, delete this exception statement from your version.
+ *
+ *  Kaidan is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Kaidan.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+// std
+#include <functional>
+// Qt
+#include <QObject>
+#include <QQueue>
+#include <QSet>
+#include <QVector>
+// Kaidan
+#include "Message.h"
+
+class DeliveryStateAggregator;
+class StreamTracker;
+class QXmppClient;
+
+/**
+ * @class MessageOutbox Queue of messages waiting to be sent
+ *
+ * Pending messages are loaded from the database page by page and only a limited number
+ * of them is sent without being acknowledged by the server. If Stream Management
+ * (XEP-0198) is enabled, a message is only marked as sent once the server acknowledged
+ * it. Otherwise, it is marked as sent as soon as it was written to the stream.
+ */
+class MessageOutbox : public QObject
+{
+	Q_OBJECT
+
+public:
+	/**
+	 * Function writing a message to the stream and returning whether that succeeded
+	 */
+	using MessageSender = std::function<bool (const Message &message)>;
+
+	/**
+	 * @param client client whose disconnections stop sending
+	 * @param messageSender function used to send the messages
+	 * @param streamTracker tracker of the server's acknowledgements
+	 * @param deliveryStateAggregator aggregator for the delivery states of sent messages
+	 * @param parent optional QObject-based parent
+	 */
+	MessageOutbox(QXmppClient *client, const MessageSender &messageSender, StreamTracker *streamTracker, DeliveryStateAggregator *deliveryStateAggregator, QObject *parent = nullptr);
+	~MessageOutbox();
+
+	/**
+	 * Enqueues a new message which is already stored as pending.
+	 *
+	 * If the client is not connected, the message is sent with the other pending
+	 * messages after the next login.
+	 */
+	void enqueue(const Message &message);
+
+	/**
+	 * Starts sending all pending messages stored in the database.
+	 *
+	 * If the stream was resumed, the messages enqueued before the connection loss are
+	 * sent instead.
+	 */
+	void sendPendingMessages();
+
+	/**
+	 * Stops waiting for the server's acknowledgement of a message because it was already
+	 * delivered to its recipient.
+	 *
+	 * @param id ID of the message
+	 */
+	void handleMessageDelivered(const QString &id);
+
+	/**
+	 * Enqueues a page of pending messages loaded from the database.
+	 *
+	 * @param messages pending messages in the order they were stored
+	 * @param lastRowId row ID of the last loaded message
+	 */
+	void handlePendingMessagesFetched(const QVector<Message> &messages, qint64 lastRowId);
+
+signals:
+	/**
+	 * Emitted to load the next page of pending messages of the current account.
+	 *
+	 * The results must be passed to handlePendingMessagesFetched() in the order of the
+	 * requests.
+	 *
+	 * @param lastRowId row ID of the last loaded message
+	 * @param limit maximum number of messages to load
+	 */
+	void fetchPendingMessagesRequested(qint64 lastRowId, int limit);
+
+	/**
+	 * Emitted when a message could not be written to the stream.
+	 *
+	 * @param id ID of the message
+	 */
+	void sendingFailed(const QString &id);
+
+private:
+	struct QueuedMessage {
+		quint64 sequenceNumber;
+		Message message;
+	};
+
+	struct UnacknowledgedMessage {
+		quint64 sequenceNumber;
+		QString id;
+		// number of the message's stanza within the stream (counted as by XEP-0198)
+		quint32 stanzaNumber;
+	};
+
+	void handleDisconnected();
+
+	/**
+	 * Sends queued messages as long as not too many are unacknowledged and requests
+	 * the next page of pending messages if the queue runs low.
+	 */
+	void drain();
+
+	/**
+	 * Sends a message.
+	 *
+	 * @return true if the message could be written to the stream
+	 */
+	bool send(const QueuedMessage &queuedMessage);
+
+	void enqueueMessage(const Message &message);
+	void fetchPendingMessages();
+
+	/**
+	 * Marks all messages acknowledged by the server as sent.
+	 *
+	 * @param handledStanzas number of stanzas handled by the server
+	 */
+	void handleAcknowledgement(quint32 handledStanzas);
+
+	/**
+	 * Marks all unacknowledged messages as sent without waiting for the server.
+	 */
+	void markUnacknowledgedMessagesAsSent();
+
+	MessageSender m_messageSender;
+	StreamTracker *m_streamTracker;
+	DeliveryStateAggregator *m_deliveryStateAggregator;
+
+	QQueue<QueuedMessage> m_queue;
+	QVector<UnacknowledgedMessage> m_unacknowledgedMessages;
+	// IDs of all messages queued or sent during the current session
+	QSet<QString> m_knownMessageIds;
+	quint64 m_nextSequenceNumber = 0;
+
+	bool m_isSendingEnabled = false;
+	bool m_isFetchingPendingMessages = false;
+	// generations of the requested pages whose results are not received yet, in the
+	// order of the requests
+	QQueue<quint32> m_pendingMessagesFetchGenerations;
+	// generation of the queue, incremented each time it is reset
+	quint32 m_pendingMessagesFetchGeneration = 0;
+	bool m_hasMorePendingMessages = false;
+	qint64 m_lastFetchedRowId = 0;
+};
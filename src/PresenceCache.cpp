@@ -110,42 +110,57 @@ PresenceCache::~PresenceCache()
 
 QString PresenceCache::pickIdealResource(const QString &jid)
 {
-	if (!m_presences.contains(jid))
-		return {};
-
-	const auto &userPresences = m_presences[jid];
-	if (userPresences.isEmpty())
-		return {};
-	if (userPresences.size() == 1)
-		return userPresences.firstKey();
-
-	auto result = userPresences.cbegin();
-	for (auto itr = result + 1; itr != userPresences.cend(); itr++) {
-		if (presenceMoreImportant(*itr, *result))
-			result = itr;
-	}
-
-	return result.key();
+	return m_presences.value(jid).idealResource;
 }
 
 QList<QString> PresenceCache::resources(const QString &jid)
 {
-	if (!m_presences.contains(jid))
-		return {};
+	if (const auto itr = m_presences.constFind(jid); itr != m_presences.cend())
+		return itr->resources.keys();
 
-	return m_presences.value(jid).keys();
+	return {};
 }
 
 std::optional<QXmppPresence> PresenceCache::presence(const QString &jid, const QString &resource)
+{
+	if (const auto resourcePresence = this->resourcePresence(jid, resource)) {
+		QXmppPresence presence;
+		presence.setFrom(jid + u'/' + resource);
+		presence.setAvailableStatusType(resourcePresence->availability);
+		presence.setPriority(resourcePresence->priority);
+		presence.setStatusText(resourcePresence->statusText);
+		presence.setCapabilityVer(resourcePresence->capabilityVer);
+		return presence;
+	}
+	return std::nullopt;
+}
+
+std::optional<PresenceCache::ResourcePresence> PresenceCache::resourcePresence(const QString &jid, const QString &resource) const
 {
 	if (const auto itr = m_presences.constFind(jid); itr != m_presences.cend()) {
-		if (const auto resourceItr = itr->constFind(resource); resourceItr != itr->cend()) {
+		if (const auto resourceItr = itr->resources.constFind(resource); resourceItr != itr->resources.cend()) {
 			return *resourceItr;
 		}
 	}
 	return std::nullopt;
 }
 
+void PresenceCache::subscribe(const QString &jid, Subscriber *subscriber)
+{
+	auto &subscribers = m_subscribers[jid];
+	if (!subscribers.contains(subscriber))
+		subscribers.append(subscriber);
+}
+
+void PresenceCache::unsubscribe(const QString &jid, Subscriber *subscriber)
+{
+	if (auto itr = m_subscribers.find(jid); itr != m_subscribers.end()) {
+		itr->removeOne(subscriber);
+		if (itr->isEmpty())
+			m_subscribers.erase(itr);
+	}
+}
+
 void PresenceCache::updatePresence(const QXmppPresence &presence)
 {
 	if (presence.type() != QXmppPresence::Available && presence.type() != QXmppPresence::Unavailable)
@@ -154,10 +169,7 @@ void PresenceCache::updatePresence(const QXmppPresence &presence)
 	const auto jid = QXmppUtils::jidToBareJid(presence.from());
 	const auto resource = QXmppUtils::jidToResource(presence.from());
 
-	if (!m_presences.contains(jid))
-		m_presences.insert(jid, {});
-
-	auto &userPresences = m_presences[jid];
+	auto userPresencesItr = m_presences.find(jid);
 
 	//
 	// Presence updates can only go this way:
@@ -168,23 +180,30 @@ void PresenceCache::updatePresence(const QXmppPresence &presence)
 	//                          ^_______/
 	//
 
-	if (userPresences.contains(resource)) {
+	if (userPresencesItr != m_presences.end() && userPresencesItr->resources.contains(resource)) {
 		if (presence.type() == QXmppPresence::Available) {
-			m_presences[jid][resource] = presence;
-			emit presenceChanged(Updated, jid, resource);
+			userPresencesItr->resources.insert(resource, { presence.availableStatusType(), qint8(presence.priority()), presence.statusText(), presence.capabilityVer() });
+			updateIdealResource(*userPresencesItr, resource);
+			addChange(Updated, jid, resource);
 		} else {
 			// presence is 'Unavailable'
-			userPresences.remove(resource);
-			if (userPresences.isEmpty())
-				m_presences.remove(jid);
+			userPresencesItr->resources.remove(resource);
+			if (userPresencesItr->resources.isEmpty())
+				m_presences.erase(userPresencesItr);
+			else
+				updateIdealResource(*userPresencesItr, resource);
 
-			emit presenceChanged(Disconnected, jid, resource);
+			addChange(Disconnected, jid, resource);
 		}
 	} else {
 		// client is unknown (hasn't been cached yet)
 		if (presence.type() == QXmppPresence::Available) {
-			userPresences.insert(resource, presence);
-			emit presenceChanged(Connected, jid, resource);
+			if (userPresencesItr == m_presences.end())
+				userPresencesItr = m_presences.insert(jid, {});
+
+			userPresencesItr->resources.insert(resource, { presence.availableStatusType(), qint8(presence.priority()), presence.statusText(), presence.capabilityVer() });
+			updateIdealResource(*userPresencesItr, resource);
+			addChange(Connected, jid, resource);
 		}
 
 		// presences from unknown clients that are unavailable are ignored
@@ -194,6 +213,8 @@ void PresenceCache::updatePresence(const QXmppPresence &presence)
 void PresenceCache::clear()
 {
 	m_presences.clear();
+	m_pendingChanges.clear();
+	m_lastPendingChangeIndices.clear();
 	emit presencesCleared();
 }
 
@@ -214,32 +235,118 @@ constexpr qint8 PresenceCache::availabilityPriority(QXmppPresence::AvailableStat
 	}
 }
 
-bool PresenceCache::presenceMoreImportant(const QXmppPresence &a, const QXmppPresence &b)
+bool PresenceCache::presenceMoreImportant(const ResourcePresence &a, const ResourcePresence &b)
 {
-	if (a.priority() != b.priority())
-		return a.priority() > b.priority();
+	if (a.priority != b.priority)
+		return a.priority > b.priority;
 
-	if (const auto aAvailable = availabilityPriority(a.availableStatusType()),
-		bAvailable = availabilityPriority(b.availableStatusType());
+	if (const auto aAvailable = availabilityPriority(a.availability),
+		bAvailable = availabilityPriority(b.availability);
 		aAvailable != bAvailable) {
 		return aAvailable > bAvailable;
 	}
 
-	return !a.statusText().isEmpty() > !b.statusText().isEmpty();
+	return !a.statusText.isEmpty() > !b.statusText.isEmpty();
+}
+
+bool PresenceCache::resourcePreferred(const UserPresences &userPresences, const QString &a, const QString &b)
+{
+	const auto aPresence = userPresences.resources.value(a);
+	const auto bPresence = userPresences.resources.value(b);
+
+	if (presenceMoreImportant(aPresence, bPresence))
+		return true;
+	if (presenceMoreImportant(bPresence, aPresence))
+		return false;
+
+	return a < b;
+}
+
+void PresenceCache::updateIdealResource(UserPresences &userPresences, const QString &changedResource)
+{
+	auto &idealResource = userPresences.idealResource;
+
+	// The changed resource can only replace the ideal one, unless the ideal one got less
+	// important or went offline.
+	if (changedResource != idealResource && userPresences.resources.contains(idealResource)) {
+		if (userPresences.resources.contains(changedResource) && resourcePreferred(userPresences, changedResource, idealResource))
+			idealResource = changedResource;
+		return;
+	}
+
+	const auto &resources = userPresences.resources;
+	auto result = resources.cbegin();
+	for (auto itr = result; itr != resources.cend(); ++itr) {
+		if (resourcePreferred(userPresences, itr.key(), result.key()))
+			result = itr;
+	}
+
+	idealResource = result == resources.cend() ? QString() : result.key();
+}
+
+void PresenceCache::addChange(ChangeType type, const QString &jid, const QString &resource)
+{
+	emit presenceChanged(type, jid, resource);
+
+	if (m_pendingChanges.isEmpty())
+		QMetaObject::invokeMethod(this, &PresenceCache::emitPendingChanges, Qt::QueuedConnection);
+
+	// Updates following a pending connection or update are covered by that change.
+	const auto key = qMakePair(jid, resource);
+	if (type == Updated) {
+		if (const auto itr = m_lastPendingChangeIndices.constFind(key); itr != m_lastPendingChangeIndices.cend() && m_pendingChanges.at(*itr).type != Disconnected)
+			return;
+	}
+
+	m_lastPendingChangeIndices.insert(key, m_pendingChanges.size());
+	m_pendingChanges.append({ type, jid, resource });
+}
+
+void PresenceCache::emitPendingChanges()
+{
+	if (m_pendingChanges.isEmpty())
+		return;
+
+	const auto changes = std::move(m_pendingChanges);
+	m_pendingChanges.clear();
+	m_lastPendingChangeIndices.clear();
+
+	// Notify only the subscribers of the changed JIDs.
+	QHash<QString, QVector<Change>> changesByJid;
+	for (const auto &change : changes) {
+		if (m_subscribers.contains(change.jid))
+			changesByJid[change.jid].append(change);
+	}
+
+	for (auto itr = changesByJid.cbegin(); itr != changesByJid.cend(); ++itr) {
+		// Subscribers may subscribe or unsubscribe while being notified.
+		const auto subscribers = m_subscribers.value(itr.key());
+		for (auto *subscriber : subscribers) {
+			if (m_subscribers.value(itr.key()).contains(subscriber))
+				subscriber->handlePresencesChanged(*itr);
+		}
+	}
+
+	emit presencesChanged(changes);
 }
 
 UserPresenceWatcher::UserPresenceWatcher(QObject *parent)
 	: QObject(parent), m_resourceAutoPicked(true)
 {
-	connect(PresenceCache::instance(), &PresenceCache::presenceChanged, this, &UserPresenceWatcher::handlePresenceChanged);
 	connect(PresenceCache::instance(), &PresenceCache::presencesCleared, this, &UserPresenceWatcher::handlePresencesCleared);
 }
 
+UserPresenceWatcher::~UserPresenceWatcher()
+{
+	if (auto *cache = PresenceCache::instance())
+		cache->unsubscribe(m_jid, this);
+}
+
 Presence::Availability UserPresenceWatcher::availability() const
 {
-	if (const auto presence = PresenceCache::instance()->presence(m_jid, m_resource)) {
+	if (const auto presence = PresenceCache::instance()->resourcePresence(m_jid, m_resource)) {
 		return Presence::availabilityFromAvailabilityStatusType(
-			presence->availableStatusType());
+			presence->availability);
 	}
 	return Presence::Offline;
 }
@@ -261,8 +368,8 @@ QColor UserPresenceWatcher::availabilityColor() const
 
 QString UserPresenceWatcher::statusText() const
 {
-	if (const auto presence = PresenceCache::instance()->presence(m_jid, m_resource))
-		return presence->statusText();
+	if (const auto presence = PresenceCache::instance()->resourcePresence(m_jid, m_resource))
+		return presence->statusText;
 	return {};
 }
 
@@ -274,6 +381,9 @@ QString UserPresenceWatcher::jid() const
 void UserPresenceWatcher::setJid(const QString &jid)
 {
 	if (m_jid != jid) {
+		PresenceCache::instance()->unsubscribe(m_jid, this);
+		PresenceCache::instance()->subscribe(jid, this);
+
 		m_jid = jid;
 		emit jidChanged();
 
@@ -287,29 +397,33 @@ QString UserPresenceWatcher::resource() const
 	return m_resource;
 }
 
-void UserPresenceWatcher::handlePresenceChanged(PresenceCache::ChangeType type,
-	const QString &jid,
-	const QString &resource)
-{
-	if (m_jid == jid) {
-		if (m_resourceAutoPicked) {
-			// no matter if a new device has connected, a device has
-			// disconnected or a device's presence has been updated, we
-			// always need to reselect the device to get the most important
-			// presence:
-			const auto resourceChanged = autoPickResource();
-
-			if (!resourceChanged && type == PresenceCache::Updated && m_resource == resource) {
-				// If the resource didn't change, the notify signals won't
-				// be emitted. However, if the current resource's presence
-				// was updated, we still want those signals to be emitted.
-				emit presencePropertiesChanged();
-			}
-		} else if (m_resource == resource) {
-			// the resource is fixed: we only need to call the updated-
-			// signals since the resource can't change
+void UserPresenceWatcher::handlePresencesChanged(const QVector<PresenceCache::Change> &changes)
+{
+	bool isResourceUpdated = false;
+
+	// The changes are only checked against the resource selected before handling them.
+	for (const auto &change : changes) {
+		if (change.resource == m_resource && (change.type == PresenceCache::Updated || !m_resourceAutoPicked))
+			isResourceUpdated = true;
+	}
+
+	if (m_resourceAutoPicked) {
+		// no matter if a new device has connected, a device has
+		// disconnected or a device's presence has been updated, we
+		// always need to reselect the device to get the most important
+		// presence:
+		const auto resourceChanged = autoPickResource();
+
+		if (!resourceChanged && isResourceUpdated) {
+			// If the resource didn't change, the notify signals won't
+			// be emitted. However, if the current resource's presence
+			// was updated, we still want those signals to be emitted.
 			emit presencePropertiesChanged();
 		}
+	} else if (isResourceUpdated) {
+		// the resource is fixed: we only need to call the updated-
+		// signals since the resource can't change
+		emit presencePropertiesChanged();
 	}
 }
 
@@ -34,7 +34,10 @@
 #include <optional>
 // Qt
 #include <QColor>
+#include <QHash>
 #include <QObject>
+#include <QPair>
+#include <QVector>
 // QXmpp
 #include <QXmppPresence.h>
 
@@ -71,6 +74,12 @@ public:
 
 /**
  * @class PresenceCache A cache for presence holders for certain JIDs
+ *
+ * Only the parts of the presences needed by Kaidan are stored. The ideal resource of each
+ * JID is updated with each presence instead of being searched on each request.
+ *
+ * Objects interested in the presences of a single JID subscribe to it so that they are
+ * only notified about changes of that JID.
  */
 class PresenceCache : public QObject
 {
@@ -84,6 +93,41 @@ public:
 	};
 	Q_ENUM(ChangeType)
 
+	/**
+	 * Presence of one resource
+	 */
+	struct ResourcePresence
+	{
+		QXmppPresence::AvailableStatusType availability = QXmppPresence::Online;
+		qint8 priority = 0;
+		QString statusText;
+		QByteArray capabilityVer;
+	};
+
+	/**
+	 * Change of a resource's presence
+	 */
+	struct Change
+	{
+		ChangeType type;
+		QString jid;
+		QString resource;
+	};
+
+	/**
+	 * Receiver of the presence changes of subscribed JIDs
+	 */
+	class Subscriber
+	{
+	public:
+		virtual ~Subscriber() = default;
+
+		/**
+		 * Handles the changes of one subscribed JID since the last notification.
+		 */
+		virtual void handlePresencesChanged(const QVector<PresenceCache::Change> &changes) = 0;
+	};
+
 	PresenceCache(QObject *parent = nullptr);
 	~PresenceCache();
 
@@ -95,6 +139,19 @@ public:
 	QString pickIdealResource(const QString &jid);
 	QList<QString> resources(const QString &jid);
 	std::optional<QXmppPresence> presence(const QString &jid, const QString &resource);
+	std::optional<ResourcePresence> resourcePresence(const QString &jid, const QString &resource) const;
+
+	/**
+	 * Notifies a subscriber about the presence changes of a JID.
+	 *
+	 * The subscriber must be unsubscribed before it is destroyed.
+	 */
+	void subscribe(const QString &jid, Subscriber *subscriber);
+
+	/**
+	 * Stops notifying a subscriber about the presence changes of a JID.
+	 */
+	void unsubscribe(const QString &jid, Subscriber *subscriber);
 
 public slots:
 	/**
@@ -109,21 +166,53 @@ public slots:
 
 signals:
 	/**
-	 * Notifies about changed presences
+	 * Notifies about a changed presence immediately
 	 */
 	void presenceChanged(PresenceCache::ChangeType type, const QString &jid, const QString &resource);
+
+	/**
+	 * Notifies about all presences changed since the last emission
+	 *
+	 * The signal is emitted once per event loop iteration. Consecutive updates of the same
+	 * resource are merged.
+	 */
+	void presencesChanged(const QVector<PresenceCache::Change> &changes);
+
 	void presencesCleared();
 
 private:
+	struct UserPresences
+	{
+		QHash<QString, ResourcePresence> resources;
+		QString idealResource;
+	};
+
 	constexpr qint8 availabilityPriority(QXmppPresence::AvailableStatusType type);
-	bool presenceMoreImportant(const QXmppPresence &a, const QXmppPresence &b);
+	bool presenceMoreImportant(const ResourcePresence &a, const ResourcePresence &b);
+
+	/**
+	 * Returns whether a resource should be picked instead of another one.
+	 *
+	 * Resources with equally important presences are picked in alphabetical order.
+	 */
+	bool resourcePreferred(const UserPresences &userPresences, const QString &a, const QString &b);
+
+	void updateIdealResource(UserPresences &userPresences, const QString &changedResource);
+	void addChange(ChangeType type, const QString &jid, const QString &resource);
+	void emitPendingChanges();
+
+	QHash<QString, UserPresences> m_presences;
+
+	QVector<Change> m_pendingChanges;
+	// indices of the last pending changes by JID and resource
+	QHash<QPair<QString, QString>, int> m_lastPendingChangeIndices;
 
-	QMap<QString, QMap<QString, QXmppPresence>> m_presences;
+	QHash<QString, QVector<Subscriber *>> m_subscribers;
 
 	static PresenceCache *s_instance;
 };
 
-class UserPresenceWatcher : public QObject
+class UserPresenceWatcher : public QObject, public PresenceCache::Subscriber
 {
 	Q_OBJECT
 	Q_PROPERTY(QString jid READ jid WRITE setJid NOTIFY jidChanged)
@@ -136,6 +225,7 @@ class UserPresenceWatcher : public QObject
 
 public:
 	explicit UserPresenceWatcher(QObject *parent = nullptr);
+	~UserPresenceWatcher() override;
 
 	QString jid() const;
 	void setJid(const QString &jid);
@@ -154,9 +244,7 @@ public:
 	Q_SIGNAL void presencePropertiesChanged();
 
 private:
-	Q_SLOT void handlePresenceChanged(PresenceCache::ChangeType type,
-		const QString &jid,
-		const QString &resource);
+	void handlePresencesChanged(const QVector<PresenceCache::Change> &changes) override;
 	Q_SLOT void handlePresencesCleared();
 
 	bool autoPickResource();
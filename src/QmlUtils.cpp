@@ -40,6 +40,8 @@
 #include <QStringBuilder>
 // QXmpp
 #include "qxmpp-exts/QXmppColorGenerator.h"
+// Kaidan
+#include "MediaUtils.h"
 
 static QmlUtils *s_instance;
 
@@ -137,7 +139,7 @@ QUrl QmlUtils::issueTrackingUrl()
 
 bool QmlUtils::isImageFile(const QUrl &fileUrl)
 {
-	QMimeType type = QMimeDatabase().mimeTypeForUrl(fileUrl);
+	const QMimeType type = MediaUtils::mimeType(fileUrl);
 	return type.inherits("image/jpeg") || type.inherits("image/png");
 }
 
@@ -159,9 +161,31 @@ QString QmlUtils::fileSizeFromUrl(const QUrl &url)
 
 QString QmlUtils::formatMessage(const QString &message)
 {
-	// escape all special XML chars (like '<' and '>')
-	// and spilt into words for processing
-	return processMsgFormatting(message.toHtmlEscaped().split(" "));
+	return formatMessage(message, MediaUtils::findUris(message));
+}
+
+QString QmlUtils::formatMessage(const QString &message, const QVector<MediaUtils::UriSpan> &uris)
+{
+	QString formattedMessage;
+
+	// escape all special XML chars (like '<' and '>') and preserve newlines
+	const auto appendText = [&](int from, int to) {
+		formattedMessage += message.mid(from, to - from).toHtmlEscaped().replace(u'\n', QStringLiteral("<br>"));
+	};
+
+	// link highlighting
+	int position = 0;
+	for (const auto &uri : uris) {
+		if (!uri.url.scheme().startsWith(QStringLiteral("http"), Qt::CaseInsensitive))
+			continue;
+
+		appendText(position, uri.position);
+		formattedMessage += QStringLiteral("<a href='%1'>%1</a>").arg(message.mid(uri.position, uri.length).toHtmlEscaped());
+		position = uri.position + uri.length;
+	}
+	appendText(position, message.size());
+
+	return formattedMessage;
 }
 
 QColor QmlUtils::getUserColor(const QString &nickName)
@@ -239,21 +263,3 @@ QString QmlUtils::chatStateDescription(const QString &displayName, const QXmppMe
 
 	return {};
 }
-
-QString QmlUtils::processMsgFormatting(const QStringList &list, bool isFirst)
-{
-	if (list.isEmpty())
-		return QString();
-
-	// link highlighting
-	if (list.first().startsWith("https://") || list.first().startsWith("http://"))
-		return (isFirst ? QString() : " ") + QString("<a href='%1'>%1</a>").arg(list.first())
-		       + processMsgFormatting(list.mid(1), false);
-
-	// preserve newlines
-	if (list.first().contains("\n"))
-		return (isFirst ? QString() : " ") + QString(list.first()).replace("\n", "<br>")
-		       + processMsgFormatting(list.mid(1), false);
-
-	return (isFirst ? QString() : " ") + list.first() + processMsgFormatting(list.mid(1), false);
-}
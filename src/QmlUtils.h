@@ -37,6 +37,7 @@
 
 #include "ClientWorker.h"
 #include "Globals.h"
+#include "MediaUtils.h"
 
 /**
  * @brief C++ utitlities to be used in QML
@@ -146,6 +147,14 @@ public:
 	 */
 	Q_INVOKABLE static QString formatMessage(const QString &message);
 
+	/**
+	 * Styles/formats a message for displaying by the URIs already found in it
+	 *
+	 * @param message text of the message
+	 * @param uris URIs found in the message by MediaUtils::findUris()
+	 */
+	static QString formatMessage(const QString &message, const QVector<MediaUtils::UriSpan> &uris);
+
 	/**
 	 * Returns a consistent user color generated from the nickname.
 	 */
@@ -171,10 +180,4 @@ public:
 	 * Returns a human-readable string describing the state of the chat
 	 */
 	Q_INVOKABLE static QString chatStateDescription(const QString &displayName, const QXmppMessage::State state);
-
-private:
-	/**
-	 * Highlights links in a list of words
-	 */
-	static QString processMsgFormatting(const QStringList &words, bool isFirst = true);
 };
@@ -57,6 +57,16 @@ QrCodeDecoder::QrCodeDecoder(QObject *parent)
 }
 
 void QrCodeDecoder::decodeImage(const QImage &image)
+{
+	// If a QR code could be found and decoded, emit a signal with the decoded string.
+	// Otherwise, emit a signal for failed decoding.
+	if (const auto result = decode(image); !result.isEmpty())
+		emit decodingSucceeded(result);
+	else
+		emit decodingFailed();
+}
+
+QString QrCodeDecoder::decode(const QImage &image)
 {
 	// Advise the decoder to check for QR codes and to try decoding rotated versions of the image.
 #if ZXING_VERSION >= QT_VERSION_CHECK(1, 1, 0)
@@ -68,16 +78,13 @@ void QrCodeDecoder::decodeImage(const QImage &image)
 
 	// Create a binarized image by the luminance of the image.
 	HybridBinarizer binImage(std::make_shared<GenericLuminanceSource>(GenericLuminanceSource(
-		image.width(), image.height(), image.bits(), image.width(), 1, 0, 1, 2)));
+		image.width(), image.height(), image.bits(), image.bytesPerLine(), 1, 0, 1, 2)));
 
 	// Decode the specific image source.
 	const auto result = MultiFormatReader(decodeHints).read(binImage);
 #endif
 
-	// If a QR code could be found and decoded, emit a signal with the decoded string.
-	// Otherwise, emit a signal for failed decoding.
 	if (result.isValid())
-		emit decodingSucceeded(QString::fromStdString(TextUtfEncoding::ToUtf8(result.text())));
-	else
-		emit decodingFailed();
+		return QString::fromStdString(TextUtfEncoding::ToUtf8(result.text()));
+	return {};
 }
@@ -31,6 +31,7 @@
 #pragma once
 
 #include <QObject>
+class QImage;
 
 /**
  * Decoder for QR codes. This is a backend for \c QrCodeScanner .
@@ -47,6 +48,17 @@ public:
 	 */
 	explicit QrCodeDecoder(QObject *parent = nullptr);
 
+	/**
+	 * Decodes the QR code from the given image without emitting any signal.
+	 *
+	 * This can be called from any thread.
+	 *
+	 * @param image grayscale image (one byte per pixel) which may contain a QR code
+	 *
+	 * @return decoded string or an empty string if no QR code could be decoded
+	 */
+	static QString decode(const QImage &image);
+
 signals:
 	/**
 	 * Emitted when the decoding failed.
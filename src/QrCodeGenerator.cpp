@@ -30,27 +30,104 @@
 
 #include "QrCodeGenerator.h"
 
+#include <QHash>
 #include <QImage>
+#include <QMutex>
+#include <QMutexLocker>
 #include <QRgb>
 
 #include <ZXing/BarcodeFormat.h>
 #include <ZXing/MultiFormatWriter.h>
+#if __has_include(<ZXing/ZXVersion.h>)
+#include <ZXing/ZXVersion.h>
+#endif
+
+// BitMatrix::row() is available since ZXing-C++ 1.2.
+#if ZXING_VERSION_MAJOR > 1 || (ZXING_VERSION_MAJOR == 1 && ZXING_VERSION_MINOR >= 2)
+#define ZXING_BIT_MATRIX_HAS_ROWS
+#else
+#include <ZXing/BitArray.h>
+#endif
 
 #include "AccountManager.h"
+#include "Globals.h"
+#include "ImageCache.h"
 #include "Kaidan.h"
 #include "qxmpp-exts/QXmppUri.h"
 
+#include <algorithm>
 #include <stdexcept>
 
 #define COLOR_TABLE_INDEX_FOR_WHITE 0
 #define COLOR_TABLE_INDEX_FOR_BLACK 1
 
+// maximum number of bytes of the generated QR codes kept in memory
+constexpr int QR_CODE_CACHE_SIZE = 2 * 1024 * 1024;
+
+// generated QR codes by their edge sizes and texts
+static ImageCache s_qrCodeCache(QR_CODE_CACHE_SIZE);
+
+struct QrCodeText
+{
+	QString text;
+	bool isCacheable;
+};
+
+// texts of the QR codes provided by the QrCodeImageProvider by their tokens
+//
+// Each generator only registers the text of its latest URL. Thus, there are never more
+// texts than generators.
+static QMutex s_qrCodeTextsMutex;
+static QHash<QString, QrCodeText> s_qrCodeTexts;
+static quint64 s_nextQrCodeToken = 0;
+
 QrCodeGenerator::QrCodeGenerator(QObject *parent)
 	: QObject(parent)
 {
 }
 
+QrCodeGenerator::~QrCodeGenerator()
+{
+	QMutexLocker locker(&s_qrCodeTextsMutex);
+	s_qrCodeTexts.remove(m_token);
+}
+
 QImage QrCodeGenerator::generateLoginUriQrCode(int edgePixelCount)
+{
+	return generateQrCode(edgePixelCount, loginUri(), false);
+}
+
+QImage QrCodeGenerator::generateBareJidQrCode(int edgePixelCount, const QString &bareJid)
+{
+	return generateQrCode(edgePixelCount, bareJidUri(bareJid));
+}
+
+QImage QrCodeGenerator::generateQrCode(int edgePixelCount, const QString &text, bool isCacheable)
+{
+	const auto cacheKey = QString::number(edgePixelCount) + QLatin1Char(' ') + text;
+
+	if (isCacheable) {
+		if (const auto image = s_qrCodeCache.image(cacheKey); !image.isNull())
+			return image;
+	}
+
+	try {
+		ZXing::MultiFormatWriter writer(ZXing::BarcodeFormat::QR_CODE);
+		const ZXing::BitMatrix &bitMatrix = writer.encode(text.toStdWString(), edgePixelCount, edgePixelCount);
+		const QImage image = toImage(bitMatrix);
+
+		if (isCacheable)
+			s_qrCodeCache.insert(cacheKey, image);
+
+		return image;
+	} catch (const std::invalid_argument &e) {
+		emit Kaidan::instance()->passiveNotificationRequested(tr("Generating the QR code failed: %1").arg(e.what()));
+	}
+
+	return {};
+}
+
+QString QrCodeGenerator::loginUri()
 {
 	QXmppUri uri;
 
@@ -60,40 +137,82 @@ QImage QrCodeGenerator::generateLoginUriQrCode(int edgePixelCount)
 	if (Kaidan::instance()->passwordVisibility() != Kaidan::PasswordInvisible)
 		uri.setPassword(AccountManager::instance()->password());
 
-	return generateQrCode(edgePixelCount, uri.toString());
+	return uri.toString();
 }
 
-QImage QrCodeGenerator::generateBareJidQrCode(int edgePixelCount, const QString &bareJid)
+QString QrCodeGenerator::bareJidUri(const QString &bareJid)
 {
 	QXmppUri uri;
 	uri.setJid(bareJid);
 
-	return generateQrCode(edgePixelCount, uri.toString());
+	return uri.toString();
 }
 
-QImage QrCodeGenerator::generateQrCode(int edgePixelCount, const QString &text)
+QImage QrCodeGenerator::generateQrCodeForToken(int edgePixelCount, const QString &token)
 {
-	try {
-		ZXing::MultiFormatWriter writer(ZXing::BarcodeFormat::QR_CODE);
-		const ZXing::BitMatrix &bitMatrix = writer.encode(text.toStdWString(), edgePixelCount, edgePixelCount);
-		return toImage(bitMatrix);
-	} catch (const std::invalid_argument &e) {
-		emit Kaidan::instance()->passiveNotificationRequested(tr("Generating the QR code failed: %1").arg(e.what()));
+	QrCodeText qrCodeText;
+
+	{
+		QMutexLocker locker(&s_qrCodeTextsMutex);
+		const auto itr = s_qrCodeTexts.constFind(token);
+		if (itr == s_qrCodeTexts.cend())
+			return {};
+		qrCodeText = *itr;
 	}
 
-	return {};
+	return generateQrCode(edgePixelCount, qrCodeText.text, qrCodeText.isCacheable);
+}
+
+QUrl QrCodeGenerator::qrCodeUrl(const QString &text, bool isCacheable)
+{
+	QMutexLocker locker(&s_qrCodeTextsMutex);
+
+	// The token is kept as long as the text does not change so that the URL stays the
+	// same. Otherwise, the previous text is released and a token that has never been
+	// used before is registered.
+	if (const auto itr = s_qrCodeTexts.constFind(m_token); itr == s_qrCodeTexts.cend() || itr->text != text || itr->isCacheable != isCacheable) {
+		s_qrCodeTexts.remove(m_token);
+		m_token = QString::number(s_nextQrCodeToken++);
+		s_qrCodeTexts.insert(m_token, { text, isCacheable });
+	}
+
+	return QUrl(QStringLiteral("image://" QR_CODE_IMAGE_PROVIDER_NAME "/") + m_token);
 }
 
 QImage QrCodeGenerator::toImage(const ZXing::BitMatrix &bitMatrix)
 {
-	QImage monochromeImage(bitMatrix.width(), bitMatrix.height(), QImage::Format_Mono);
+	const int width = bitMatrix.width();
+	const int height = bitMatrix.height();
+
+	QImage monochromeImage(width, height, QImage::Format_Mono);
 
 	createColorTable(monochromeImage);
 
-	for (int y = 0; y < bitMatrix.height(); ++y) {
-		for (int x = 0; x < bitMatrix.width(); ++x) {
-			int colorTableIndex = bitMatrix.get(x, y) ? COLOR_TABLE_INDEX_FOR_BLACK : COLOR_TABLE_INDEX_FOR_WHITE;
-			monochromeImage.setPixel(y, x, colorTableIndex);
+#ifndef ZXING_BIT_MATRIX_HAS_ROWS
+	ZXing::BitArray row;
+#endif
+
+	// The modules of each row are read sequentially and the pixels of Format_Mono are
+	// stored with the most significant bit first.
+	for (int y = 0; y < height; ++y) {
+#ifdef ZXING_BIT_MATRIX_HAS_ROWS
+		const auto row = bitMatrix.row(y);
+#else
+		bitMatrix.getRow(y, row);
+#endif
+		auto module = row.begin();
+		uchar *scanLine = monochromeImage.scanLine(y);
+
+		for (int byteStart = 0; byteStart < width; byteStart += 8) {
+			const int bitCount = std::min(8, width - byteStart);
+			uchar byte = 0;
+
+			for (int bit = 0; bit < bitCount; ++bit, ++module) {
+				if (*module)
+					byte |= uchar(0x80 >> bit);
+			}
+
+			*scanLine++ = byte;
 		}
 	}
 
@@ -31,6 +31,7 @@
 #pragma once
 
 #include <QObject>
+#include <QUrl>
 
 #include <ZXing/BitMatrix.h>
 
@@ -47,6 +48,7 @@ public:
 	 * @param parent parent object
 	 */
 	explicit QrCodeGenerator(QObject *parent = nullptr);
+	~QrCodeGenerator();
 
 	/**
 	 * Gerenates a QR code encoding the credentials of the currently used account to log into it with another client.
@@ -66,15 +68,62 @@ public:
 	/**
 	 * Gerenates a QR code.
 	 *
+	 * Recently generated QR codes are cached if they are cacheable.
+	 * This can be called from any thread.
+	 *
 	 * @param edgePixelCount number of pixels as the width and height of the QR code
 	 * @param text string being encoded as a QR code
+	 * @param isCacheable whether the QR code may be kept in memory (false for texts
+	 * containing credentials)
 	 */
-	Q_INVOKABLE static QImage generateQrCode(int edgePixelCount, const QString &text);
+	Q_INVOKABLE static QImage generateQrCode(int edgePixelCount, const QString &text, bool isCacheable = true);
+
+	/**
+	 * Gerenates the QR code for a token returned by qrCodeUrl().
+	 *
+	 * This can be called from any thread.
+	 *
+	 * @param edgePixelCount number of pixels as the width and height of the QR code
+	 * @param token token of the text being encoded as a QR code
+	 *
+	 * @return the QR code or a null image if the token is unknown
+	 */
+	static QImage generateQrCodeForToken(int edgePixelCount, const QString &token);
+
+	/**
+	 * Returns the XMPP URI for logging into the currently used account with another client.
+	 */
+	Q_INVOKABLE static QString loginUri();
+
+	/**
+	 * Returns an XMPP URI containing a given bare JID.
+	 *
+	 * @param bareJid bare JID being encoded in an XMPP URI
+	 */
+	Q_INVOKABLE static QString bareJidUri(const QString &bareJid);
+
+	/**
+	 * Returns the URL of a QR code provided by the QrCodeImageProvider.
+	 *
+	 * The URL contains only an opaque token for the text so that the text is not
+	 * exposed by logged URLs.
+	 * The QR code is generated in the background for the size of the image requesting it.
+	 *
+	 * Only the text of the latest URL is provided. It is released as soon as another text
+	 * is passed or this generator is destroyed.
+	 *
+	 * @param text string being encoded as a QR code
+	 * @param isCacheable whether the QR code may be kept in memory (false for texts
+	 * containing credentials)
+	 */
+	Q_INVOKABLE QUrl qrCodeUrl(const QString &text, bool isCacheable = true);
 
 private:
 	/**
 	 * Generates an image with black and white pixels from a given matrix of bits representing a QR code.
 	 *
+	 * The modules of each row of the matrix are packed into the bytes of the image's scanlines.
+	 *
 	 * @param bitMatrix matrix of bits representing the two colors black and white
 	 */
 	static QImage toImage(const ZXing::BitMatrix &bitMatrix);
@@ -84,4 +133,6 @@ private:
 	 * @param blackAndWhiteImage image for which a color table with the colors black and white is created
 	 */
 	static void createColorTable(QImage &blackAndWhiteImage);
+
+	QString m_token;
 };
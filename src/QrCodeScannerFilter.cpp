@@ -35,6 +35,16 @@
 #include <QCameraViewfinderSettings>
 #include <QtConcurrent/QtConcurrent>
 
+// minimum and maximum time between the starts of processing two frames
+constexpr qint64 MIN_PROCESSING_INTERVAL_MS = 50;
+constexpr qint64 MAX_PROCESSING_INTERVAL_MS = 1000;
+
+// ratio of the time between processing two frames to the processing time
+constexpr qint64 PROCESSING_INTERVAL_FACTOR = 2;
+
+// minimum width and height of downscaled images which are decoded before the full ones
+constexpr int MIN_DOWNSCALED_IMAGE_SIZE = 240;
+
 QrCodeScannerFilter::QrCodeScannerFilter(QObject *parent)
 	: QAbstractVideoFilter(parent),
 	  m_decoder(new QrCodeDecoder(this))
@@ -75,6 +85,19 @@ void QrCodeScannerFilter::setCameraDefaultVideoFormat(QObject *qmlCamera)
 	}
 }
 
+QRectF QrCodeScannerFilter::captureRect() const
+{
+	return m_captureRect;
+}
+
+void QrCodeScannerFilter::setCaptureRect(const QRectF &captureRect)
+{
+	if (m_captureRect != captureRect) {
+		m_captureRect = captureRect;
+		emit captureRectChanged();
+	}
+}
+
 QrCodeScannerFilterRunnable::QrCodeScannerFilterRunnable(QrCodeScannerFilter *filter)
 	: QObject(nullptr),
 	m_filter(filter)
@@ -93,32 +116,44 @@ QVideoFrame QrCodeScannerFilterRunnable::run(
 		return *input;
 	}
 
+	// Frames are skipped so that the processing does not occupy the CPU all the time.
+	if (m_filter->m_processingTimer.isValid()
+			&& m_filter->m_processingTimer.elapsed() < m_filter->m_processingInterval) {
+		return *input;
+	}
+
+	m_filter->m_processingTimer.start();
+
 	// Copy the data to be filtered.
-	m_filter->m_frame.setData(*input);
+	// The filter's properties can be accessed because the GUI thread is blocked while the
+	// filters are run.
+	m_filter->m_frame.setData(*input, m_filter->m_captureRect);
 
 	// Run a separate thread for processing the data.
 	m_filter->m_processThread = QtConcurrent::run(
 			this,
 			&QrCodeScannerFilterRunnable::processVideoFrameProbed,
-			m_filter->m_frame,
 			m_filter
 	);
 	return *input;
 }
 
-void QrCodeScannerFilterRunnable::processVideoFrameProbed(
-		QrCodeVideoFrame videoFrame,
-		QrCodeScannerFilter *filter
-) {
+void QrCodeScannerFilterRunnable::processVideoFrameProbed(QrCodeScannerFilter *filter)
+{
+	QElapsedTimer processingTimer;
+	processingTimer.start();
+
+	QrCodeVideoFrame &videoFrame = filter->m_frame;
+
 	// Return if the frame is empty.
 	if (videoFrame.data().isEmpty())
 		return;
 
 	// Create an image from the frame.
-	const QImage *image = videoFrame.toGrayscaleImage();
+	const QImage &image = videoFrame.toGrayscaleImage();
 
 	// Return if conversion from the frame to the image failed.
-	if (image->isNull()) {
+	if (image.isNull()) {
 		// dirty hack: write QVideoFrame::PixelFormat as string to format using QDebug
 		//             QMetaEnum::valueToKey() did not work
 		QString format;
@@ -134,8 +169,21 @@ void QrCodeScannerFilterRunnable::processVideoFrameProbed(
 		return;
 	}
 
-	// Decode the image.
-	m_filter->decoder()->decodeImage(*image);
-
-	delete image;
+	// Decode a downscaled image first and the full image only if that failed.
+	QString result;
+	if (qMin(image.width(), image.height()) >= 2 * MIN_DOWNSCALED_IMAGE_SIZE)
+		result = QrCodeDecoder::decode(videoFrame.toDownscaledGrayscaleImage());
+	if (result.isEmpty())
+		result = QrCodeDecoder::decode(image);
+
+	if (result.isEmpty())
+		emit filter->decoder()->decodingFailed();
+	else
+		emit filter->decoder()->decodingSucceeded(result);
+
+	filter->m_processingInterval = qBound(
+		MIN_PROCESSING_INTERVAL_MS,
+		processingTimer.elapsed() * PROCESSING_INTERVAL_FACTOR,
+		MAX_PROCESSING_INTERVAL_MS
+	);
 }
@@ -32,7 +32,9 @@
 
 #include <QObject>
 #include <QAbstractVideoFilter>
+#include <QElapsedTimer>
 #include <QFuture>
+#include <QRectF>
 
 #include "QrCodeDecoder.h"
 #include "QrCodeVideoFrame.h"
@@ -46,6 +48,8 @@ class QrCodeScannerFilter : public QAbstractVideoFilter
 
 	Q_OBJECT
 
+	Q_PROPERTY(QRectF captureRect READ captureRect WRITE setCaptureRect NOTIFY captureRectChanged)
+
 public:
 	/**
 	 * Instantiates a QR code scanner filter.
@@ -68,6 +72,15 @@ public:
 	 */
 	Q_INVOKABLE void setCameraDefaultVideoFormat(QObject *qmlCamera);
 
+	/**
+	 * Returns the region of the video frames which is scanned.
+	 *
+	 * It is relative to the frame size (e.g., QRectF(0.25, 0.25, 0.5, 0.5) for the center).
+	 * An invalid rectangle stands for the whole frame.
+	 */
+	QRectF captureRect() const;
+	void setCaptureRect(const QRectF &captureRect);
+
 signals:
 	/**
 	 * Emitted when the scanning of an image did not succeed, i.e. no valid QR code was found.
@@ -88,14 +101,24 @@ signals:
 	 */
 	void unsupportedFormatReceived(const QString& format);
 
+	void captureRectChanged();
+
 private:
 	QrCodeDecoder *m_decoder;
+	QRectF m_captureRect;
 
 	/**
 	 * frame of the video which may contain a QR code
+	 *
+	 * It is only accessed by the processing thread while a frame is processed.
 	 */
 	QrCodeVideoFrame m_frame;
 	QFuture<void> m_processThread;
+
+	// The processing of a frame is only started after the interval since the last
+	// processing started. The interval is adapted to the processing time.
+	QElapsedTimer m_processingTimer;
+	qint64 m_processingInterval = 0;
 };
 
 /**
@@ -114,12 +137,15 @@ public:
 	QVideoFrame run(QVideoFrame *input, const QVideoSurfaceFormat &surfaceFormat, RunFlags flags) override;
 
 	/**
-	 * Converts a given frame, which may contain a QR code, to an image and then tries to decode it.
+	 * Converts the filter's current frame, which may contain a QR code, to an image and then
+	 * tries to decode it.
+	 *
+	 * A downscaled image is decoded first. The image of the full size is only decoded if
+	 * that fails.
 	 *
-	 * @param videoFrame frame to be converted and which may contain a QR code to be decoded
 	 * @param filter filter of the current execution
 	 */
-	void processVideoFrameProbed(QrCodeVideoFrame videoFrame, QrCodeScannerFilter *filter);
+	void processVideoFrameProbed(QrCodeScannerFilter *filter);
 
 private:
 	QrCodeScannerFilter *m_filter;
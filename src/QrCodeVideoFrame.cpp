@@ -46,7 +46,17 @@
 
 #include "QrCodeVideoFrame.h"
 #include <QImage>
-#include <cmath>
+#include <QtMath>
+#include <array>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define QRCODEVIDEOFRAME_USE_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define QRCODEVIDEOFRAME_USE_NEON
+#include <arm_neon.h>
+#endif
 
 /**
  * rectangle of the video frame which may contain a QR code
@@ -79,217 +89,501 @@ struct CaptureRect
 	int endY;
 };
 
-uchar gray(uchar r, uchar g, uchar b)
+/**
+ * byte offsets of the color channels within a pixel
+ */
+struct ChannelOffsets
+{
+	int alpha;
+	int red;
+	int green;
+	int blue;
+};
+
+static inline uchar gray(uchar r, uchar g, uchar b)
+{
+	return (306 * r + 601 * g + 117 * b + 0x200) >> 10;
+}
+
+#if defined(QRCODEVIDEOFRAME_USE_SSE2)
+/**
+ * Converts four pixels stored in 32-bit lanes with the channels at the given byte offsets.
+ *
+ * @return gray values in 32-bit lanes
+ */
+static inline __m128i grayOfPixels(__m128i pixels, const ChannelOffsets &offsets)
+{
+	const __m128i mask = _mm_set1_epi32(0xff);
+	const __m128i r = _mm_and_si128(_mm_srl_epi32(pixels, _mm_cvtsi32_si128(offsets.red * 8)), mask);
+	const __m128i g = _mm_and_si128(_mm_srl_epi32(pixels, _mm_cvtsi32_si128(offsets.green * 8)), mask);
+	const __m128i b = _mm_and_si128(_mm_srl_epi32(pixels, _mm_cvtsi32_si128(offsets.blue * 8)), mask);
+
+	// Pairs of 16-bit values are multiplied and added: r * 306 + g * 601 and b * 117 + 1 * 0x200
+	const __m128i rg = _mm_or_si128(r, _mm_slli_epi32(g, 16));
+	const __m128i bRounding = _mm_or_si128(b, _mm_set1_epi32(1 << 16));
+	const __m128i sum = _mm_add_epi32(
+		_mm_madd_epi16(rg, _mm_set1_epi32(306 | (601 << 16))),
+		_mm_madd_epi16(bRounding, _mm_set1_epi32(117 | (0x200 << 16)))
+	);
+
+	return _mm_srli_epi32(sum, 10);
+}
+
+static inline __m128i loadPixel24(const uchar *pixel)
 {
-	return (306 * (r & 0xFF) +
-			601 * (g & 0xFF) +
-			117 * (b & 0xFF) +
-			0x200) >> 10;
+	int value;
+	std::memcpy(&value, pixel, sizeof(value));
+	return _mm_cvtsi32_si128(value);
 }
-uchar yuvToGray(uchar Y, uchar U, uchar V)
+
+/**
+ * Loads four 24-bit pixels into 32-bit lanes.
+ *
+ * One byte after the fourth pixel is read as well.
+ */
+static inline __m128i loadPixels24(const uchar *pixels)
 {
-	const int C = int(Y) - 16;
-	const int D = int(U) - 128;
-	const int E = int(V) - 128;
-	return gray(
-		qBound<uchar>(0, uchar((298 * C + 409 * E + 128) >> 8), 255),
-		qBound<uchar>(0, uchar((298 * C - 100 * D - 208 * E + 128) >> 8), 255),
-		qBound<uchar>(0, uchar((298 * C + 516 * D + 128) >> 8), 255)
+	return _mm_unpacklo_epi64(
+		_mm_unpacklo_epi32(loadPixel24(pixels), loadPixel24(pixels + 3)),
+		_mm_unpacklo_epi32(loadPixel24(pixels + 6), loadPixel24(pixels + 9))
 	);
 }
+#elif defined(QRCODEVIDEOFRAME_USE_NEON)
+static inline uint16x4_t grayOfChannels(uint16x4_t r, uint16x4_t g, uint16x4_t b)
+{
+	uint32x4_t sum = vmull_n_u16(r, 306);
+	sum = vmlal_n_u16(sum, g, 601);
+	sum = vmlal_n_u16(sum, b, 117);
+
+	// rounding shift, i.e., (sum + 0x200) >> 10
+	return vrshrn_n_u32(sum, 10);
+}
+
+static inline uint8x8_t grayOfChannels(uint8x8_t r, uint8x8_t g, uint8x8_t b)
+{
+	const uint16x8_t r16 = vmovl_u8(r);
+	const uint16x8_t g16 = vmovl_u8(g);
+	const uint16x8_t b16 = vmovl_u8(b);
+
+	return vmovn_u16(vcombine_u16(
+		grayOfChannels(vget_low_u16(r16), vget_low_u16(g16), vget_low_u16(b16)),
+		grayOfChannels(vget_high_u16(r16), vget_high_u16(g16), vget_high_u16(b16))
+	));
+}
 
-uchar yuvToGray2(uchar y, uchar u, uchar v)
+static inline uint8x16_t grayOfChannels(uint8x16_t r, uint8x16_t g, uint8x16_t b)
 {
-	double rD = y + 1.4075 * (v - 128);
-	double gD = y - 0.3455 * (u - 128) - (0.7169 * (v - 128));
-	double bD = y + 1.7790 * (u - 128);
-
-	return gray(
-		qBound<uchar>(0, uchar(floor(rD)), 255),
-		qBound<uchar>(0, uchar(floor(gD)), 255),
-		qBound<uchar>(0, uchar(floor(bD)), 255)
+	return vcombine_u8(
+		grayOfChannels(vget_low_u8(r), vget_low_u8(g), vget_low_u8(b)),
+		grayOfChannels(vget_high_u8(r), vget_high_u8(g), vget_high_u8(b))
 	);
 }
+#endif
+
+/**
+ * Converts a row of RGB pixels with three or four bytes per pixel to gray values.
+ *
+ * @param source first pixel of the row
+ * @param destination first gray value of the row
+ * @param width number of pixels
+ * @param bytesPerPixel 3 or 4
+ * @param offsets byte offsets of the color channels
+ */
+static void rgbRowToGrayscale(const uchar *source, uchar *destination, int width, int bytesPerPixel, const ChannelOffsets &offsets)
+{
+	int x = 0;
+
+#if defined(QRCODEVIDEOFRAME_USE_SSE2)
+	if (bytesPerPixel == 4) {
+		for (; x + 16 <= width; x += 16) {
+			const uchar *pixels = source + x * 4;
+			const __m128i gray0 = grayOfPixels(_mm_loadu_si128(reinterpret_cast<const __m128i *>(pixels)), offsets);
+			const __m128i gray1 = grayOfPixels(_mm_loadu_si128(reinterpret_cast<const __m128i *>(pixels + 16)), offsets);
+			const __m128i gray2 = grayOfPixels(_mm_loadu_si128(reinterpret_cast<const __m128i *>(pixels + 32)), offsets);
+			const __m128i gray3 = grayOfPixels(_mm_loadu_si128(reinterpret_cast<const __m128i *>(pixels + 48)), offsets);
+
+			_mm_storeu_si128(
+				reinterpret_cast<__m128i *>(destination + x),
+				_mm_packus_epi16(_mm_packs_epi32(gray0, gray1), _mm_packs_epi32(gray2, gray3))
+			);
+		}
+	} else {
+		// The loads read one byte after the last pixel of each block.
+		// Thus, at least one pixel is left for the scalar conversion in order not to read
+		// after the end of the row.
+		for (; x + 17 <= width; x += 16) {
+			const uchar *pixels = source + x * 3;
+			const __m128i gray0 = grayOfPixels(loadPixels24(pixels), offsets);
+			const __m128i gray1 = grayOfPixels(loadPixels24(pixels + 12), offsets);
+			const __m128i gray2 = grayOfPixels(loadPixels24(pixels + 24), offsets);
+			const __m128i gray3 = grayOfPixels(loadPixels24(pixels + 36), offsets);
+
+			_mm_storeu_si128(
+				reinterpret_cast<__m128i *>(destination + x),
+				_mm_packus_epi16(_mm_packs_epi32(gray0, gray1), _mm_packs_epi32(gray2, gray3))
+			);
+		}
+	}
+#elif defined(QRCODEVIDEOFRAME_USE_NEON)
+	if (bytesPerPixel == 4) {
+		for (; x + 16 <= width; x += 16) {
+			const uint8x16x4_t pixels = vld4q_u8(source + x * 4);
+			vst1q_u8(destination + x, grayOfChannels(pixels.val[offsets.red], pixels.val[offsets.green], pixels.val[offsets.blue]));
+		}
+	} else {
+		for (; x + 16 <= width; x += 16) {
+			const uint8x16x3_t pixels = vld3q_u8(source + x * 3);
+			vst1q_u8(destination + x, grayOfChannels(pixels.val[offsets.red], pixels.val[offsets.green], pixels.val[offsets.blue]));
+		}
+	}
+#endif
+
+	for (; x < width; ++x) {
+		const uchar *pixel = source + x * bytesPerPixel;
+		destination[x] = gray(pixel[offsets.red], pixel[offsets.green], pixel[offsets.blue]);
+	}
+}
+
+/**
+ * Reverts the premultiplication of gray values by the alpha values of their pixels.
+ *
+ * Since the gray value is a weighted sum of the color channels, the division by the alpha
+ * value is done once per pixel instead of once per channel.
+ */
+static void unpremultiplyGrayscaleRow(const uchar *source, uchar *destination, int width, int bytesPerPixel, int alphaOffset)
+{
+	// (255 << 16) / alpha for each alpha value, computed once
+	static const auto inverseAlphas = [] {
+		std::array<uint, 256> inverses = {};
+		for (uint alpha = 1; alpha < 256; alpha++)
+			inverses[alpha] = (255u << 16) / alpha;
+		return inverses;
+	}();
+
+	for (int x = 0; x < width; ++x) {
+		const uint alpha = source[x * bytesPerPixel + alphaOffset];
+		destination[x] = uchar(qMin<uint>((destination[x] * inverseAlphas[alpha]) >> 16, 255));
+	}
+}
+
+/**
+ * Prepares an image for being overwritten by a grayscale image of the given size.
+ *
+ * The image's buffer is only reallocated if the size changed.
+ */
+static void prepareGrayscaleImage(QImage &image, int width, int height)
+{
+	if (image.width() != width || image.height() != height || image.format() != QImage::Format_Grayscale8)
+		image = QImage(width, height, QImage::Format_Grayscale8);
+}
 
-static QImage* rgbDataToGrayscale(
+static void rgbDataToGrayscale(
+		QImage &image,
 		const uchar* data,
+		int bytesPerLine,
 		const CaptureRect &captureRect,
-		const int alpha,
-		const int red,
-		const int green,
-		const int blue,
+		const ChannelOffsets &offsets,
 		const bool isPremultiplied = false
 ) {
-	const int stride = (alpha < 0) ? 3 : 4;
+	const int bytesPerPixel = (offsets.alpha < 0) ? 3 : 4;
 
-	const int endX = captureRect.sourceWidth - captureRect.startX - captureRect.targetWidth;
-	const int skipX = (endX + captureRect.startX) * stride;
+	// The source rows are packed if the bytes per line are unknown.
+	if (bytesPerLine <= 0)
+		bytesPerLine = captureRect.sourceWidth * bytesPerPixel;
 
-	QImage *image_ptr = new QImage(captureRect.targetWidth, captureRect.targetHeight, QImage::Format_Grayscale8);
-	uchar* pixelInit = image_ptr->bits();
-	data += (captureRect.startY * captureRect.sourceWidth + captureRect.startX) * stride;
+	prepareGrayscaleImage(image, captureRect.targetWidth, captureRect.targetHeight);
+	data += captureRect.startY * bytesPerLine + captureRect.startX * bytesPerPixel;
 
-	for (int y = 1; y <= captureRect.targetHeight; ++y) {
+	for (int y = 0; y < captureRect.targetHeight; ++y) {
 		// Quick fix for iOS devices. Will be handled better in the future
 #ifdef Q_OS_IOS
-		uchar* pixel = pixelInit + (y - 1) * captureRect.targetWidth;
+		uchar* pixel = image.scanLine(y);
 #else
-		uchar* pixel = pixelInit + (captureRect.targetHeight - y) * captureRect.targetWidth;
+		uchar* pixel = image.scanLine(captureRect.targetHeight - y - 1);
 #endif
 
-		for (int x = 0; x < captureRect.targetWidth; ++x) {
-			uchar r = data[red];
-			uchar g = data[green];
-			uchar b = data[blue];
-			if (isPremultiplied) {
-				uchar a = data[alpha];
-				r = uchar((uint(r) * 255) / a);
-				g = uchar((uint(g) * 255) / a);
-				b = uchar((uint(b) * 255) / a);
-			}
-			*pixel = gray(r, g, b);
-			++pixel;
-			data += stride;
-		}
-		data += skipX;
+		rgbRowToGrayscale(data, pixel, captureRect.targetWidth, bytesPerPixel, offsets);
+
+		if (isPremultiplied)
+			unpremultiplyGrayscaleRow(data, pixel, captureRect.targetWidth, bytesPerPixel, offsets.alpha);
+
+		data += bytesPerLine;
+	}
+}
+
+/**
+ * Sets an image referencing the luminance plane of a YUV frame.
+ *
+ * The Y plane of planar and semi-planar YUV formats is already the luminance.
+ * Thus, it is used without any conversion.
+ * The image is only recreated if the plane's location or size changed.
+ */
+static void yPlaneToGrayscale(QImage &image, const uchar *data, int bytesPerLine, const CaptureRect &captureRect)
+{
+	if (bytesPerLine <= 0)
+		bytesPerLine = captureRect.sourceWidth;
+
+	const uchar *yPlane = data + captureRect.startY * bytesPerLine + captureRect.startX;
+
+	if (image.constBits() != yPlane
+			|| image.width() != captureRect.targetWidth
+			|| image.height() != captureRect.targetHeight
+			|| image.bytesPerLine() != bytesPerLine
+			|| image.format() != QImage::Format_Grayscale8) {
+		image = QImage(yPlane, captureRect.targetWidth, captureRect.targetHeight, bytesPerLine, QImage::Format_Grayscale8);
+	}
+}
+
+/**
+ * Extracts the luminance of a packed YUV 4:2:2 frame.
+ *
+ * @param yOffset byte offset of the first Y value within each pair of pixels
+ */
+static void packedYuvToGrayscale(QImage &image, const uchar *data, int bytesPerLine, const CaptureRect &captureRect, int yOffset)
+{
+	if (bytesPerLine <= 0)
+		bytesPerLine = captureRect.sourceWidth * 2;
+
+	prepareGrayscaleImage(image, captureRect.targetWidth, captureRect.targetHeight);
+
+	for (int y = 0; y < captureRect.targetHeight; ++y) {
+		const uchar *source = data + (captureRect.startY + y) * bytesPerLine + captureRect.startX * 2 + yOffset;
+		uchar *pixel = image.scanLine(y);
+
+		for (int x = 0; x < captureRect.targetWidth; ++x)
+			pixel[x] = source[x * 2];
+	}
+}
+
+/**
+ * Returns the number of bytes per pixel of the first plane for formats whose frames can be
+ * cropped while being copied.
+ *
+ * For planar and semi-planar YUV formats, only the Y plane is needed.
+ *
+ * @return bytes per pixel or 0 if frames of the format are copied completely
+ */
+static int croppableBytesPerPixel(QVideoFrame::PixelFormat pixelFormat)
+{
+	switch (pixelFormat) {
+	case QVideoFrame::Format_ARGB32:
+	case QVideoFrame::Format_ARGB32_Premultiplied:
+	case QVideoFrame::Format_RGB32:
+	case QVideoFrame::Format_BGRA32:
+	case QVideoFrame::Format_BGRA32_Premultiplied:
+	case QVideoFrame::Format_ABGR32:
+	case QVideoFrame::Format_BGR32:
+		return 4;
+	case QVideoFrame::Format_RGB24:
+	case QVideoFrame::Format_BGR24:
+		return 3;
+	case QVideoFrame::Format_BGR565:
+	case QVideoFrame::Format_BGR555:
+	case QVideoFrame::Format_YUYV:
+	case QVideoFrame::Format_UYVY:
+		return 2;
+	case QVideoFrame::Format_YUV420P:
+	case QVideoFrame::Format_YV12:
+	case QVideoFrame::Format_NV12:
+	case QVideoFrame::Format_NV21:
+	case QVideoFrame::Format_IMC1:
+	case QVideoFrame::Format_IMC2:
+	case QVideoFrame::Format_IMC3:
+	case QVideoFrame::Format_IMC4:
+	case QVideoFrame::Format_Y8:
+		return 1;
+	default:
+		return 0;
 	}
+}
+
+/**
+ * Converts a capture rectangle relative to the frame size to pixels.
+ *
+ * The horizontal bounds are even so that pairs of pixels sharing their chroma values in
+ * packed YUV formats are not split.
+ */
+static QRect captureRectInPixels(const QRectF &captureRect, const QSize &frameSize)
+{
+	const QRect frameRect(QPoint(0, 0), frameSize);
+
+	if (!captureRect.isValid())
+		return frameRect;
+
+	QRect rect(
+		QPoint(qFloor(captureRect.left() * frameSize.width()), qFloor(captureRect.top() * frameSize.height())),
+		QPoint(qCeil(captureRect.right() * frameSize.width()) - 1, qCeil(captureRect.bottom() * frameSize.height()) - 1)
+	);
+	rect = rect.intersected(frameRect);
+
+	rect.setLeft(rect.left() & ~1);
+	if (rect.width() % 2)
+		rect.setWidth(rect.width() - 1);
 
-	return image_ptr;
+	if (rect.isEmpty())
+		return frameRect;
+
+	return rect;
+}
+
+/**
+ * Downscales a grayscale image to half of its size by averaging blocks of 2x2 pixels.
+ */
+static void downscaleGrayscaleImage(const QImage &source, QImage &target)
+{
+	const int width = source.width() / 2;
+	const int height = source.height() / 2;
+	prepareGrayscaleImage(target, width, height);
+
+	for (int y = 0; y < height; ++y) {
+		const uchar *upperRow = source.constScanLine(y * 2);
+		const uchar *lowerRow = source.constScanLine(y * 2 + 1);
+		uchar *pixel = target.scanLine(y);
+
+		for (int x = 0; x < width; ++x) {
+			pixel[x] = uchar((upperRow[x * 2] + upperRow[x * 2 + 1] + lowerRow[x * 2] + lowerRow[x * 2 + 1] + 2) >> 2);
+		}
+	}
 }
 
-void QrCodeVideoFrame::setData(QVideoFrame &frame)
+void QrCodeVideoFrame::setData(QVideoFrame &frame, const QRectF &captureRect)
 {
 	frame.map(QAbstractVideoBuffer::ReadOnly);
 
 	// Copy video frame bytes to this.data.
 	// This is made to try to get a better performance (less memory allocation, faster unmap)
 	// Any other task is performed in a QFuture task, as we want to leave the UI thread asap.
-	if (m_data.size() != frame.mappedBytes()) {
-		m_data.resize(frame.mappedBytes());
-	}
-	memcpy(m_data.data(), frame.bits(), frame.mappedBytes());
-	m_size = frame.size();
+	// The buffer is only reallocated if the size of the copied data changed.
 	m_pixelFormat = frame.pixelFormat();
 
+	const int bytesPerPixel = croppableBytesPerPixel(m_pixelFormat);
+	const int sourceBytesPerLine = frame.bytesPerLine();
+
+	if (bytesPerPixel > 0 && sourceBytesPerLine > 0) {
+		// Only the rows and columns within the capture rectangle are copied.
+		const QRect rect = captureRectInPixels(captureRect, frame.size());
+		const int rowSize = rect.width() * bytesPerPixel;
+
+		if (m_data.size() != rowSize * rect.height()) {
+			m_data.resize(rowSize * rect.height());
+		}
+
+		const uchar *source = frame.bits() + rect.top() * sourceBytesPerLine + rect.left() * bytesPerPixel;
+		char *destination = m_data.data();
+
+		if (rowSize == sourceBytesPerLine) {
+			memcpy(destination, source, size_t(rowSize) * rect.height());
+		} else {
+			for (int y = 0; y < rect.height(); ++y) {
+				memcpy(destination, source, rowSize);
+				source += sourceBytesPerLine;
+				destination += rowSize;
+			}
+		}
+
+		m_size = rect.size();
+		m_bytesPerLine = rowSize;
+	} else {
+		if (m_data.size() != frame.mappedBytes()) {
+			m_data.resize(frame.mappedBytes());
+		}
+		memcpy(m_data.data(), frame.bits(), frame.mappedBytes());
+		m_size = frame.size();
+		m_bytesPerLine = sourceBytesPerLine;
+	}
+
 	frame.unmap();
 }
 
-QImage *QrCodeVideoFrame::toGrayscaleImage()
+const QImage &QrCodeVideoFrame::toGrayscaleImage()
 {
 	const CaptureRect captureRect(QRect(), m_size.width(), m_size.height());
 	const auto* data = reinterpret_cast<const uchar *>(m_data.constData());
-	const auto *yuvPtr = reinterpret_cast<const uint32_t *>(data);
-	uchar *pixel;
-	int wh;
-	int w_2;
-	int wh_54;
 
-	QImage *image;
 	switch (m_pixelFormat) {
 	case QVideoFrame::Format_ARGB32:
-		image = rgbDataToGrayscale(data, captureRect, 0, 1, 2, 3);
+		rgbDataToGrayscale(m_grayscaleImage, data, m_bytesPerLine, captureRect, {0, 1, 2, 3});
 		break;
 	case QVideoFrame::Format_ARGB32_Premultiplied:
-		image = rgbDataToGrayscale(data, captureRect, 0, 1, 2, 3, true);
+		rgbDataToGrayscale(m_grayscaleImage, data, m_bytesPerLine, captureRect, {0, 1, 2, 3}, true);
 		break;
 	case QVideoFrame::Format_RGB32:
-		image = rgbDataToGrayscale(data, captureRect, 0, 1, 2, 3);
+		rgbDataToGrayscale(m_grayscaleImage, data, m_bytesPerLine, captureRect, {0, 1, 2, 3});
 		break;
 	case QVideoFrame::Format_RGB24:
-		image = rgbDataToGrayscale(data, captureRect, -1, 0, 1, 2);
+		rgbDataToGrayscale(m_grayscaleImage, data, m_bytesPerLine, captureRect, {-1, 0, 1, 2});
 		break;
 	// TODO: QVideoFrame::Format_RGB565
 	// TODO: QVideoFrame::Format_RGB555
 	// TODO: QVideoFrame::Format_ARGB8565_Premultiplied
 	case QVideoFrame::Format_BGRA32:
-		image = rgbDataToGrayscale(data, captureRect, 3, 2, 1, 0);
+		rgbDataToGrayscale(m_grayscaleImage, data, m_bytesPerLine, captureRect, {3, 2, 1, 0});
 		break;
 	case QVideoFrame::Format_BGRA32_Premultiplied:
-		image = rgbDataToGrayscale(data, captureRect, 3, 2, 1, 0, true);
+		rgbDataToGrayscale(m_grayscaleImage, data, m_bytesPerLine, captureRect, {3, 2, 1, 0}, true);
 		break;
 	case QVideoFrame::Format_ABGR32:
-		image = rgbDataToGrayscale(data, captureRect, 0, 3, 2, 1);
+		rgbDataToGrayscale(m_grayscaleImage, data, m_bytesPerLine, captureRect, {0, 3, 2, 1});
 		break;
 	case QVideoFrame::Format_BGR32:
-		image = rgbDataToGrayscale(data, captureRect, 3, 2, 1, 0);
+		rgbDataToGrayscale(m_grayscaleImage, data, m_bytesPerLine, captureRect, {3, 2, 1, 0});
 		break;
 	case QVideoFrame::Format_BGR24:
-		image = rgbDataToGrayscale(data, captureRect, -1, 2, 1, 0);
+		rgbDataToGrayscale(m_grayscaleImage, data, m_bytesPerLine, captureRect, {-1, 2, 1, 0});
 		break;
 	case QVideoFrame::Format_BGR565:
 		/// This is a forced "conversion", colors end up swapped.
-		image = new QImage(data, m_size.width(), m_size.height(), QImage::Format_RGB16);
-		break;
+		m_wrappedImage = QImage(data, m_size.width(), m_size.height(), m_bytesPerLine, QImage::Format_RGB16);
+		return m_wrappedImage;
 	case QVideoFrame::Format_BGR555:
 		/// This is a forced "conversion", colors end up swapped.
-		image = new QImage(data, m_size.width(), m_size.height(), QImage::Format_RGB555);
-		break;
+		m_wrappedImage = QImage(data, m_size.width(), m_size.height(), m_bytesPerLine, QImage::Format_RGB555);
+		return m_wrappedImage;
 	// TODO: QVideoFrame::Format_BGRA5658_Premultiplied
 	case QVideoFrame::Format_YUV420P:
+	case QVideoFrame::Format_YV12:
 	case QVideoFrame::Format_NV12:
-		/// nv12 format, encountered on macOS
-		image = new QImage(captureRect.targetWidth, captureRect.targetHeight, QImage::Format_Grayscale8);
-		pixel = image->bits();
-		wh = m_size.width() * m_size.height();
-		w_2 = m_size.width() / 2;
-		wh_54 = wh * 5 / 4;
-
-		for (int y = captureRect.startY; y < captureRect.endY; y++) {
-			const int Y_offset = y * m_size.width();
-			const int y_2 = y / 2;
-			const int U_offset = y_2 * w_2 + wh;
-			const int V_offset = y_2 * w_2 + wh_54;
-			for (int x = captureRect.startX; x < captureRect.endX; x++) {
-				const int x_2 = x / 2;
-				const uchar Y = data[Y_offset + x];
-				const uchar U = data[U_offset + x_2];
-				const uchar V = data[V_offset + x_2];
-				*pixel = yuvToGray(Y, U, V);
-				++pixel;
-			}
-		}
-		break;
 	case QVideoFrame::Format_NV21:
+	case QVideoFrame::Format_IMC1:
+	case QVideoFrame::Format_IMC2:
+	case QVideoFrame::Format_IMC3:
+	case QVideoFrame::Format_IMC4:
+	case QVideoFrame::Format_Y8:
+		/// nv12 format, encountered on macOS
 		/// nv21 format, default on android
 		/// image starts with a complete Y image, which we can use directly
-		image = new QImage(data, captureRect.targetWidth, captureRect.targetHeight, QImage::Format_Grayscale8);
-		break;
+		yPlaneToGrayscale(m_wrappedImage, data, m_bytesPerLine, captureRect);
+		return m_wrappedImage;
 	case QVideoFrame::Format_YUYV:
-		image = new QImage(captureRect.targetWidth, captureRect.targetHeight, QImage::Format_Grayscale8);
-		pixel = image->bits();
-
-		for (int y = captureRect.startY; y < captureRect.endY; y++){
-			const uint32_t *row = &yuvPtr[y*(m_size.width()/2)];
-			int end = captureRect.startX/2 + (captureRect.endX - captureRect.startX)/2;
-			for (int x = captureRect.startX/2; x < end; x++){
-				const uint8_t *pxl = reinterpret_cast<const uint8_t *>(&row[x]);
-				const uint8_t y0 = pxl[0];
-				const uint8_t u  = pxl[1];
-				const uint8_t v  = pxl[3];
-				const uint8_t y1 = pxl[2];
-
-				*pixel = yuvToGray2(y0, u, v);
-				++pixel;
-				*pixel = yuvToGray2(y1, u, v);
-				++pixel;
-			}
-		}
-
+		packedYuvToGrayscale(m_grayscaleImage, data, m_bytesPerLine, captureRect, 0);
+		break;
+	case QVideoFrame::Format_UYVY:
+		packedYuvToGrayscale(m_grayscaleImage, data, m_bytesPerLine, captureRect, 1);
 		break;
-	// TODO: QVideoFrame::Format_IMC*
-	// TODO: QVideoFrame::Format_*YUV*
-	// TODO: QVideoFrame::Format_Y*
 	// TODO: QVideoFrame::Format_Jpeg (needed?)
 	default:
-		image = new QImage(
+		m_wrappedImage = QImage(
 			data,
 			m_size.width(),
 			m_size.height(),
+			m_bytesPerLine,
 			QVideoFrame::imageFormatFromPixelFormat(m_pixelFormat)
 		);
-		break;
+		return m_wrappedImage;
 	}
-	return image;
+	return m_grayscaleImage;
+}
+
+const QImage &QrCodeVideoFrame::toDownscaledGrayscaleImage()
+{
+	const QImage &image = toGrayscaleImage();
+
+	// Images of formats without a grayscale conversion are not downscaled.
+	if (image.format() != QImage::Format_Grayscale8)
+		return image;
+
+	downscaleGrayscaleImage(image, m_downscaledImage);
+	return m_downscaledImage;
 }
 
 QByteArray QrCodeVideoFrame::data() const
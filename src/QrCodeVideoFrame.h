@@ -47,9 +47,10 @@
 #pragma once
 
 #include <QByteArray>
+#include <QImage>
+#include <QRectF>
 #include <QSize>
 #include <QVideoFrame>
-class QImage;
 
 /**
  * video frame which may contain a QR code
@@ -68,16 +69,36 @@ public:
 	/**
 	 * Sets the frame.
 	 *
+	 * Only the part of the frame within the capture rectangle is copied if the frame's
+	 * format supports it.
+	 *
 	 * @param frame frame to be set
+	 * @param captureRect region of the frame which may contain a QR code relative to the
+	 *        frame's size (e.g., QRectF(0.25, 0.25, 0.5, 0.5) for the center), or an invalid
+	 *        rectangle for the whole frame
 	 */
-	void setData(QVideoFrame &frame);
+	void setData(QVideoFrame &frame, const QRectF &captureRect = {});
 
 	/**
-	 * Converts a given image to a grayscale image.
+	 * Converts the frame to a grayscale image.
+	 *
+	 * The image's buffer is reused for following frames of the same size.
+	 * The luminance plane of YUV frames is referenced without conversion. Thus, the
+	 * returned image must not be used after the frame has been changed or destroyed.
 	 *
 	 * @return grayscale image
 	 */
-	QImage *toGrayscaleImage();
+	const QImage &toGrayscaleImage();
+
+	/**
+	 * Converts the frame to a grayscale image of half its size.
+	 *
+	 * Decoding a downscaled image is faster and often sufficient for QR codes covering a
+	 * large part of the frame.
+	 *
+	 * @return downscaled grayscale image
+	 */
+	const QImage &toDownscaledGrayscaleImage();
 
 	/**
 	 * @return content of the frame which may contain a QR code
@@ -97,5 +118,12 @@ public:
 private:
 	QByteArray m_data;
 	QSize m_size;
+	int m_bytesPerLine = 0;
 	QVideoFrame::PixelFormat m_pixelFormat;
+
+	QImage m_grayscaleImage;
+	QImage m_downscaledImage;
+
+	// image referencing the frame's data
+	QImage m_wrappedImage;
 };
@@ -54,6 +54,9 @@ RosterDb::RosterDb(Database *db, QObject *parent)
 	connect(this, &RosterDb::fetchItemsRequested, this, &RosterDb::fetchItems);
 	connect(this, &RosterDb::updateItemRequested, this, &RosterDb::updateItem);
 	connect(this, &RosterDb::removeItemsRequested, this, &RosterDb::removeItems);
+	connect(this, &RosterDb::fetchRosterVersionRequested, this, &RosterDb::fetchRosterVersion);
+	connect(this, &RosterDb::replaceItemsRequested, this, &RosterDb::replaceItems);
+	connect(this, &RosterDb::applyRosterPushRequested, this, &RosterDb::applyRosterPush);
 }
 
 RosterDb::~RosterDb()
@@ -164,52 +167,124 @@ void RosterDb::updateItem(const QString &jid,
 	}
 }
 
-void RosterDb::replaceItems(const QHash<QString, RosterItem> &items)
+void RosterDb::replaceItems(const QString &accountJid, const QHash<QString, RosterItem> &items, const QString &version)
 {
-	// load current items
 	QSqlDatabase db = QSqlDatabase::database(DB_CONNECTION);
+	m_db->transaction();
+
+	// load the names of the current items
 	QSqlQuery query(db);
 	query.setForwardOnly(true);
-	Utils::execQuery(query, "SELECT * FROM Roster");
+	Utils::execQuery(query, "SELECT jid, name FROM " DB_TABLE_ROSTER);
 
-	QVector<RosterItem> currentItems;
-	parseItemsFromQuery(query, currentItems);
+	QHash<QString, QString> currentNames;
+	while (query.next())
+		currentNames.insert(query.value(0).toString(), query.value(1).toString());
 
-	m_db->transaction();
+	// Each statement is prepared once and only executed for the changed items.
+	QSqlQuery removeQuery(db);
+	Utils::prepareQuery(removeQuery, "DELETE FROM " DB_TABLE_ROSTER " WHERE jid = ?");
+
+	QSqlQuery updateQuery(db);
+	Utils::prepareQuery(updateQuery, "UPDATE " DB_TABLE_ROSTER " SET name = ? WHERE jid = ?");
 
-	QList<QString> keys = items.keys();
-	QSet<QString> newJids = QSet<QString>(keys.begin(), keys.end());
+	QSqlQuery insertQuery(db);
+	Utils::prepareQuery(insertQuery, db.driver()->sqlStatement(
+		QSqlDriver::InsertStatement,
+		DB_TABLE_ROSTER,
+		db.record(DB_TABLE_ROSTER),
+		true
+	));
 
-	for (const auto &oldItem : qAsConst(currentItems)) {
-		// We will remove the already existing JIDs, so we get a set of JIDs that
-		// are completely new.
-		//
-		// By calling remove(), we also find out whether the JID is already
-		// existing or not.
-		if (newJids.remove(oldItem.jid())) {
-			// item is also included in newJids -> update
+	for (auto itr = currentNames.cbegin(); itr != currentNames.cend(); ++itr) {
+		if (!items.contains(itr.key())) {
+			removeQuery.addBindValue(itr.key());
+			Utils::execQuery(removeQuery);
+		}
+	}
 
+	for (auto itr = items.cbegin(); itr != items.cend(); ++itr) {
+		const auto &item = itr.value();
+		const auto currentName = currentNames.constFind(itr.key());
+
+		if (currentName == currentNames.cend()) {
+			insertQuery.addBindValue(item.jid());
+			insertQuery.addBindValue(item.name());
+			insertQuery.addBindValue(QStringLiteral("")); // lastExchanged (NOT NULL)
+			insertQuery.addBindValue(item.unreadMessages());
+			insertQuery.addBindValue(QString()); // lastMessage
+			Utils::execQuery(insertQuery);
+		} else if (*currentName != item.name()) {
 			// name is (currently) the only attribute that is defined by the
 			// XMPP roster and so could cause a change
-			if (oldItem.name() != items[oldItem.jid()].name())
-				setItemName(oldItem.jid(), items[oldItem.jid()].name());
+			updateQuery.addBindValue(item.name());
+			updateQuery.addBindValue(item.jid());
+			Utils::execQuery(updateQuery);
+		}
+	}
+
+	updateRosterVersion(accountJid, version);
+
+	m_db->commit();
+}
+
+void RosterDb::applyRosterPush(const QString &accountJid, const QXmppRosterIq &push)
+{
+	QSqlQuery query(QSqlDatabase::database(DB_CONNECTION));
+	m_db->transaction();
+
+	const auto items = push.items();
+	for (const auto &item : items) {
+		if (item.subscriptionType() == QXmppRosterIq::Item::Remove) {
+			Utils::execQuery(
+				query,
+				"DELETE FROM " DB_TABLE_ROSTER " WHERE jid = ?",
+				QVector<QVariant>() << item.bareJid()
+			);
 		} else {
-			// item is not included in newJids -> delete
-			removeItems({}, oldItem.jid());
+			Utils::execQuery(
+				query,
+				"UPDATE " DB_TABLE_ROSTER " SET name = ? WHERE jid = ?",
+				QVector<QVariant>() << item.name() << item.bareJid()
+			);
+
+			if (query.numRowsAffected() < 1)
+				addItem(RosterItem(item));
 		}
 	}
 
-	// now add the completely new JIDs
-	for (const QString &jid : newJids)
-		addItem(items[jid]);
+	// Without a new version, the stored one is kept since the server does not support
+	// roster versioning.
+	if (!push.version().isEmpty())
+		updateRosterVersion(accountJid, push.version());
 
 	m_db->commit();
 }
 
-void RosterDb::removeItems(const QString &, const QString &)
+void RosterDb::removeItems(const QString &accountJid, const QString &jid)
 {
 	QSqlQuery query(QSqlDatabase::database(DB_CONNECTION));
-	Utils::execQuery(query, "DELETE FROM Roster");
+
+	if (jid.isEmpty()) {
+		m_db->transaction();
+
+		Utils::execQuery(query, "DELETE FROM " DB_TABLE_ROSTER);
+
+		// The stored version is only valid together with the removed items.
+		Utils::execQuery(
+			query,
+			"DELETE FROM " DB_TABLE_ROSTER_VERSIONS " WHERE accountJid = ?",
+			QVector<QVariant>() << accountJid
+		);
+
+		m_db->commit();
+	} else {
+		Utils::execQuery(
+			query,
+			"DELETE FROM " DB_TABLE_ROSTER " WHERE jid = ?",
+			QVector<QVariant>() << jid
+		);
+	}
 }
 
 void RosterDb::setItemName(const QString &jid, const QString &name)
@@ -250,6 +325,35 @@ void RosterDb::fetchItems(const QString &accountId)
 	emit itemsFetched(items);
 }
 
+void RosterDb::fetchRosterVersion(const QString &accountJid)
+{
+	QSqlQuery query(QSqlDatabase::database(DB_CONNECTION));
+	query.setForwardOnly(true);
+
+	QXmppRosterIq roster;
+	roster.setType(QXmppIq::Result);
+
+	Utils::execQuery(
+		query,
+		"SELECT version FROM " DB_TABLE_ROSTER_VERSIONS " WHERE accountJid = ?",
+		QVector<QVariant>() << accountJid
+	);
+
+	if (query.next())
+		roster.setVersion(query.value(0).toString());
+
+	Utils::execQuery(query, "SELECT jid, name FROM " DB_TABLE_ROSTER);
+
+	while (query.next()) {
+		QXmppRosterIq::Item item;
+		item.setBareJid(query.value(0).toString());
+		item.setName(query.value(1).toString());
+		roster.addItem(item);
+	}
+
+	emit rosterVersionFetched(roster);
+}
+
 void RosterDb::updateItemByRecord(const QString &jid, const QSqlRecord &record)
 {
 	QSqlDatabase db = QSqlDatabase::database(DB_CONNECTION);
@@ -270,3 +374,22 @@ void RosterDb::updateItemByRecord(const QString &jid, const QSqlRecord &record)
 		Utils::simpleWhereStatement(db.driver(), keyValuePairs)
 	);
 }
+
+void RosterDb::updateRosterVersion(const QString &accountJid, const QString &version)
+{
+	QSqlQuery query(QSqlDatabase::database(DB_CONNECTION));
+
+	if (version.isEmpty()) {
+		Utils::execQuery(
+			query,
+			"DELETE FROM " DB_TABLE_ROSTER_VERSIONS " WHERE accountJid = ?",
+			QVector<QVariant>() << accountJid
+		);
+	} else {
+		Utils::execQuery(
+			query,
+			"INSERT OR REPLACE INTO " DB_TABLE_ROSTER_VERSIONS " (accountJid, version) VALUES (?, ?)",
+			QVector<QVariant>() << accountJid << version
+		);
+	}
+}
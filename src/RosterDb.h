@@ -34,6 +34,8 @@
 #include <QObject>
 class QSqlQuery;
 class QSqlRecord;
+// QXmpp
+#include <QXmppRosterIq.h>
 // Kaidan
 class RosterItem;
 class Database;
@@ -74,12 +76,68 @@ signals:
 	 */
 	void removeItemsRequested(const QString &accountJid, const QString &jid = {});
 
+	/**
+	 * Emitted to fetch the stored roster of an account including its version.
+	 *
+	 * @param accountJid JID of the account whose roster is fetched
+	 */
+	void fetchRosterVersionRequested(const QString &accountJid);
+
+	/**
+	 * Emitted when the stored roster of an account has been fetched.
+	 *
+	 * The roster is built from the stored roster items. Their subscription states are
+	 * not stored. If no version is stored, the passed roster has no version.
+	 *
+	 * @param roster stored roster including its version
+	 */
+	void rosterVersionFetched(const QXmppRosterIq &roster);
+
+	/**
+	 * Emitted to replace all stored roster items by the ones of a received roster.
+	 *
+	 * @param accountJid JID of the account whose roster items are replaced
+	 * @param items new roster items mapped to their JIDs
+	 * @param version version of the received roster
+	 */
+	void replaceItemsRequested(const QString &accountJid, const QHash<QString, RosterItem> &items, const QString &version);
+
+	/**
+	 * Emitted to apply the changes of a roster push to the stored roster items.
+	 *
+	 * @param accountJid JID of the account whose roster items are changed
+	 * @param push roster push containing the changed items and the new version
+	 */
+	void applyRosterPushRequested(const QString &accountJid, const QXmppRosterIq &push);
+
 public slots:
 	void addItem(const RosterItem &item);
 	void addItems(const QVector<RosterItem> &items);
 	void updateItem(const QString &jid,
 	                const std::function<void (RosterItem &)> &updateItem);
-	void replaceItems(const QHash<QString, RosterItem> &items);
+
+	/**
+	 * Replaces all stored roster items by new ones.
+	 *
+	 * Only the differences are written within a single transaction which also stores
+	 * the roster's version.
+	 *
+	 * @param accountJid JID of the account whose roster items are replaced
+	 * @param items new roster items mapped to their JIDs
+	 * @param version version of the new roster
+	 */
+	void replaceItems(const QString &accountJid, const QHash<QString, RosterItem> &items, const QString &version);
+
+	/**
+	 * Applies the changes of a roster push to the stored roster items.
+	 *
+	 * The changes are written within a single transaction which also stores the
+	 * roster's new version.
+	 *
+	 * @param accountJid JID of the account whose roster items are changed
+	 * @param push roster push containing the changed items and the new version
+	 */
+	void applyRosterPush(const QString &accountJid, const QXmppRosterIq &push);
 
 	/**
 	 * Removes all roster items of an account or a specific roster item.
@@ -93,10 +151,18 @@ public slots:
 
 private slots:
 	void fetchItems(const QString &accountId);
+	void fetchRosterVersion(const QString &accountJid);
 
 private:
 	void updateItemByRecord(const QString &jid, const QSqlRecord &record);
 
+	/**
+	 * Stores the version of an account's roster or removes it if it is empty.
+	 *
+	 * This must be called within the transaction changing the roster items.
+	 */
+	void updateRosterVersion(const QString &accountJid, const QString &version);
+
 	Database *m_db;
 
 	static RosterDb *s_instance;
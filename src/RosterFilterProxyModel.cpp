@@ -29,17 +29,125 @@
  */
 
 #include "RosterFilterProxyModel.h"
+
+#include <algorithm>
+
 #include "RosterModel.h"
 
+// scores of the kinds of matches between a search key and a search text
+constexpr int SCORE_KEY_PREFIX = 3000;
+constexpr int SCORE_WORD_PREFIX = 2000;
+constexpr int SCORE_SUBSTRING = 1000;
+constexpr int SCORE_SUBSEQUENCE = 999;
+
 RosterFilterProxyModel::RosterFilterProxyModel(QObject *parent)
 	: QSortFilterProxyModel(parent)
 {
 }
 
+int RosterFilterProxyModel::matchScore(const QString &searchKey, const QString &searchText)
+{
+	// All occurrences are checked since a later one can start a word (e.g. the JID) while
+	// the first one is within a word.
+	int substringScore = 0;
+	for (int position = searchKey.indexOf(searchText); position != -1; position = searchKey.indexOf(searchText, position + 1)) {
+		if (position == 0)
+			return SCORE_KEY_PREFIX;
+
+		// The JID after the name and its parts count as words as well.
+		if (!searchKey.at(position - 1).isLetterOrNumber())
+			return SCORE_WORD_PREFIX;
+
+		substringScore = SCORE_SUBSTRING;
+	}
+
+	if (substringScore)
+		return substringScore;
+
+	// Search the characters in order and prefer matches with less characters in between.
+	int position = 0;
+	int gaps = 0;
+	for (const auto character : searchText) {
+		const int foundPosition = searchKey.indexOf(character, position);
+		if (foundPosition == -1)
+			return 0;
+
+		gaps += foundPosition - position;
+		position = foundPosition + 1;
+	}
+
+	return std::max(1, SCORE_SUBSEQUENCE - gaps);
+}
+
+QString RosterFilterProxyModel::searchText() const
+{
+	return m_searchText;
+}
+
+void RosterFilterProxyModel::setSearchText(const QString &searchText)
+{
+	if (m_searchText == searchText)
+		return;
+
+	m_searchText = searchText;
+	const auto foldedSearchText = RosterItem::foldForSearch(searchText);
+
+	if (foldedSearchText != m_foldedSearchText) {
+		// If the search text is only extended, only the items matching before need to
+		// be checked.
+		m_isNarrowing = !m_foldedSearchText.isEmpty() && foldedSearchText.startsWith(m_foldedSearchText);
+		if (m_isNarrowing)
+			m_previousScores = std::move(m_scores);
+
+		m_scores.clear();
+		m_foldedSearchText = foldedSearchText;
+		invalidateFilter();
+
+		m_isNarrowing = false;
+		m_previousScores.clear();
+
+		// Rank the items while searching, otherwise keep the roster's order.
+		sort(m_foldedSearchText.isEmpty() ? -1 : 0);
+	}
+
+	emit searchTextChanged();
+}
+
 bool RosterFilterProxyModel::filterAcceptsRow(int sourceRow, const QModelIndex &sourceParent) const
 {
-	QModelIndex index = sourceModel()->index(sourceRow, 0, sourceParent);
+	if (m_foldedSearchText.isEmpty())
+		return true;
+
+	const auto searchKey = sourceModel()->data(sourceModel()->index(sourceRow, 0, sourceParent), RosterModel::SearchKeyRole).toString();
+
+	if (m_isNarrowing && !m_previousScores.contains(searchKey))
+		return false;
+
+	const int score = matchScore(searchKey, m_foldedSearchText);
+	if (score == 0)
+		return false;
+
+	m_scores.insert(searchKey, score);
+	return true;
+}
+
+bool RosterFilterProxyModel::lessThan(const QModelIndex &sourceLeft, const QModelIndex &sourceRight) const
+{
+	// Items with equal scores are kept in the roster's order.
+	if (const int leftScore = score(sourceLeft), rightScore = score(sourceRight); leftScore != rightScore)
+		return leftScore > rightScore;
+
+	return sourceLeft.row() < sourceRight.row();
+}
+
+int RosterFilterProxyModel::score(const QModelIndex &sourceIndex) const
+{
+	const auto searchKey = sourceModel()->data(sourceIndex, RosterModel::SearchKeyRole).toString();
+
+	if (const auto itr = m_scores.constFind(searchKey); itr != m_scores.cend())
+		return *itr;
 
-	return sourceModel()->data(index, RosterModel::NameRole).toString().toLower().contains(filterRegExp()) ||
-		sourceModel()->data(index, RosterModel::JidRole).toString().toLower().contains(filterRegExp());
+	const int score = matchScore(searchKey, m_foldedSearchText);
+	m_scores.insert(searchKey, score);
+	return score;
 }
@@ -30,14 +30,56 @@
 
 #pragma once
 
+#include <QHash>
 #include <QSortFilterProxyModel>
 
+/**
+ * Filters the roster by a search text and ranks the matching items.
+ *
+ * The search text is matched against the folded search keys of the roster items. Items
+ * whose name or JID start with the search text come first, followed by items containing
+ * it and items containing its characters in the same order.
+ */
 class RosterFilterProxyModel : public QSortFilterProxyModel
 {
 	Q_OBJECT
 
+	Q_PROPERTY(QString searchText READ searchText WRITE setSearchText NOTIFY searchTextChanged)
+
 public:
 	RosterFilterProxyModel(QObject *parent = nullptr);
 
+	QString searchText() const;
+	void setSearchText(const QString &searchText);
+
 	bool filterAcceptsRow(int sourceRow, const QModelIndex &sourceParent) const override;
+	bool lessThan(const QModelIndex &sourceLeft, const QModelIndex &sourceRight) const override;
+
+	/**
+	 * Calculates how well a search key matches a search text.
+	 *
+	 * The best match of all occurrences of the search text is used.
+	 *
+	 * @param searchKey folded search key of a roster item
+	 * @param searchText folded search text
+	 *
+	 * @return 0 if the search text does not match, otherwise a score which is higher for
+	 * better matches
+	 */
+	static int matchScore(const QString &searchKey, const QString &searchText);
+
+signals:
+	void searchTextChanged();
+
+private:
+	int score(const QModelIndex &sourceIndex) const;
+
+	QString m_searchText;
+	QString m_foldedSearchText;
+
+	// scores of the matching search keys for the current search text
+	mutable QHash<QString, int> m_scores;
+	// scores for the previous search text if the current one extends it
+	QHash<QString, int> m_previousScores;
+	bool m_isNarrowing = false;
 };
@@ -33,6 +33,7 @@
 RosterItem::RosterItem(const QXmppRosterIq::Item &item, const QDateTime &dateTime)
 	: m_jid(item.bareJid()), m_name(item.name()), m_lastExchanged(dateTime)
 {
+	updateSearchKey();
 }
 
 QString RosterItem::jid() const
@@ -43,6 +44,7 @@ QString RosterItem::jid() const
 void RosterItem::setJid(const QString &jid)
 {
 	m_jid = jid;
+	updateSearchKey();
 }
 
 QString RosterItem::name() const
@@ -53,6 +55,7 @@ QString RosterItem::name() const
 void RosterItem::setName(const QString &name)
 {
 	m_name = name;
+	updateSearchKey();
 }
 
 int RosterItem::unreadMessages() const
@@ -90,6 +93,32 @@ QString RosterItem::displayName() const
 	return m_name.isEmpty() ? m_jid : m_name;
 }
 
+QString RosterItem::searchKey() const
+{
+	return m_searchKey;
+}
+
+QString RosterItem::foldForSearch(const QString &text)
+{
+	// Decompose the characters so that diacritics become separate marks which are removed.
+	const auto decomposedText = text.normalized(QString::NormalizationForm_KD);
+
+	QString foldedText;
+	foldedText.reserve(decomposedText.size());
+
+	for (const auto character : decomposedText) {
+		if (character.category() != QChar::Mark_NonSpacing)
+			foldedText.append(character);
+	}
+
+	return foldedText.toCaseFolded();
+}
+
+void RosterItem::updateSearchKey()
+{
+	m_searchKey = foldForSearch(m_name) + QLatin1Char('\n') + foldForSearch(m_jid);
+}
+
 bool RosterItem::operator==(const RosterItem &other) const
 {
 	return m_jid == other.jid() &&
@@ -59,6 +59,16 @@ public:
 
 	QString displayName() const;
 
+	/**
+	 * Returns the folded name and JID used to search for the item.
+	 */
+	QString searchKey() const;
+
+	/**
+	 * Folds a text for searching by removing its diacritics and case differences.
+	 */
+	static QString foldForSearch(const QString &text);
+
 	bool operator==(const RosterItem &other) const;
 	bool operator!=(const RosterItem &other) const;
 
@@ -93,6 +103,13 @@ private:
 	 * Last message of the conversation.
 	 */
 	QString m_lastMessage;
+
+	/**
+	 * Folded name and JID separated by a new line, updated when one of them changes.
+	 */
+	QString m_searchKey;
+
+	void updateSearchKey();
 };
 
 Q_DECLARE_METATYPE(RosterItem);
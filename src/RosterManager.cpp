@@ -31,14 +31,18 @@
 #include "RosterManager.h"
 // Kaidan
 #include "AvatarFileStorage.h"
+#include "AccountManager.h"
 #include "Kaidan.h"
 #include "MessageModel.h"
+#include "RosterDb.h"
 #include "RosterModel.h"
+#include "RosterVersioningExtension.h"
 #include "VCardManager.h"
 // QXmpp
 #include <QXmppRosterManager.h>
 
 RosterManager::RosterManager(QXmppClient *client,
+                             StreamTracker *streamTracker,
                              AvatarFileStorage *avatarStorage,
                              VCardManager *vCardManager,
                              QObject *parent)
@@ -46,19 +50,44 @@ RosterManager::RosterManager(QXmppClient *client,
 	  m_client(client),
 	  m_avatarStorage(avatarStorage),
 	  m_vCardManager(vCardManager),
-	  m_manager(client->findExtension<QXmppRosterManager>())
+	  m_manager(client->findExtension<QXmppRosterManager>()),
+	  m_versioningExtension(new RosterVersioningExtension(m_manager, streamTracker))
 {
-	connect(m_manager, &QXmppRosterManager::rosterReceived,
+	// The extension must handle the roster results before the QXmppRosterManager.
+	client->insertExtension(0, m_versioningExtension);
+
+	// An unchanged roster is not sent by the server and does not need to be replaced.
+	connect(m_versioningExtension, &RosterVersioningExtension::fullRosterReceived,
 	        this, &RosterManager::populateRoster);
+	connect(m_versioningExtension, &RosterVersioningExtension::rosterReceived, this, [this]() {
+		m_vCardManager->requestMissingVCards(m_manager->getRosterBareJids());
+	});
+
+	// Load the stored roster while connecting so that only the changes need to be requested.
+	connect(client, &QXmppClient::stateChanged, this, [](QXmppClient::State state) {
+		if (state == QXmppClient::ConnectingState)
+			emit RosterDb::instance()->fetchRosterVersionRequested(AccountManager::instance()->jid());
+	});
+	connect(RosterDb::instance(), &RosterDb::rosterVersionFetched,
+	        m_versioningExtension, &RosterVersioningExtension::setStoredRoster);
+	connect(m_versioningExtension, &RosterVersioningExtension::rosterPushReceived,
+	        this, [](const QXmppRosterIq &push) {
+		emit RosterDb::instance()->applyRosterPushRequested(AccountManager::instance()->jid(), push);
+	});
 
 	connect(m_manager, &QXmppRosterManager::itemAdded,
 		this, [this, vCardManager] (const QString &jid) {
 		emit RosterModel::instance()->addItemRequested(RosterItem(m_manager->getRosterEntry(jid)));
-		vCardManager->requestVCard(jid);
+		vCardManager->requestMissingVCards({ jid });
 	});
 
 	connect(m_manager, &QXmppRosterManager::itemChanged,
 		this, [this] (const QString &jid) {
+		// The items passed to the manager before the roster is received are handled by
+		// populateRoster().
+		if (!m_versioningExtension->isRosterReceived())
+			return;
+
 		emit RosterModel::instance()->updateItemRequested(jid, [=] (RosterItem &item) {
 			item.setName(m_manager->getRosterEntry(jid).name());
 		});
@@ -102,22 +131,19 @@ RosterManager::RosterManager(QXmppClient *client,
 	connect(this, &RosterManager::renameContactRequested, this, &RosterManager::renameContact);
 }
 
-void RosterManager::populateRoster()
+void RosterManager::populateRoster(const QXmppRosterIq &roster)
 {
 	qDebug() << "[client] [RosterManager] Populating roster";
 	// create a new list of contacts
 	QHash<QString, RosterItem> items;
-	const QStringList bareJids = m_manager->getRosterBareJids();
+	const auto rosterItems = roster.items();
 	const auto initialTime = QDateTime::fromMSecsSinceEpoch(0);
-	for (const auto &jid : bareJids) {
-		items.insert(jid, RosterItem(m_manager->getRosterEntry(jid), initialTime));
-
-		if (m_avatarStorage->getHashOfJid(jid).isEmpty())
-			m_vCardManager->requestVCard(jid);
-	}
+	for (const auto &rosterItem : rosterItems)
+		items.insert(rosterItem.bareJid(), RosterItem(rosterItem, initialTime));
 
 	// replace current contacts with new ones from server
 	emit RosterModel::instance()->replaceItemsRequested(items);
+	emit RosterDb::instance()->replaceItemsRequested(AccountManager::instance()->jid(), items, roster.version());
 }
 
 void RosterManager::addContact(const QString &jid, const QString &name, const QString &msg)
@@ -34,9 +34,12 @@
 #include <QObject>
 // QXmpp
 class QXmppClient;
+class QXmppRosterIq;
 class QXmppRosterManager;
 // Kaidan
 class AvatarFileStorage;
+class RosterVersioningExtension;
+class StreamTracker;
 class VCardManager;
 
 class RosterManager : public QObject
@@ -44,7 +47,7 @@ class RosterManager : public QObject
 	Q_OBJECT
 
 public:
-	RosterManager(QXmppClient *client, AvatarFileStorage *avatarStorage, VCardManager *vCardManager, QObject *parent = nullptr);
+	RosterManager(QXmppClient *client, StreamTracker *streamTracker, AvatarFileStorage *avatarStorage, VCardManager *vCardManager, QObject *parent = nullptr);
 
 signals:
 	/**
@@ -79,11 +82,12 @@ public slots:
 	void renameContact(const QString &jid, const QString &newContactName);
 
 private slots:
-	void populateRoster();
+	void populateRoster(const QXmppRosterIq &roster);
 
 private:
 	QXmppClient *m_client;
 	AvatarFileStorage *m_avatarStorage;
 	VCardManager *m_vCardManager;
 	QXmppRosterManager *m_manager;
+	RosterVersioningExtension *m_versioningExtension;
 };
@@ -30,6 +30,10 @@
 
 #include "RosterModel.h"
 
+// std
+#include <algorithm>
+// Qt
+#include <QSet>
 // Kaidan
 #include "AccountManager.h"
 #include "Kaidan.h"
@@ -55,8 +59,8 @@ RosterModel::RosterModel(QObject *parent)
 	connect(RosterDb::instance(), &RosterDb::itemsFetched,
 		this, &RosterModel::handleItemsFetched);
 
+	// Roster pushes and received rosters are stored by the RosterManager.
 	connect(this, &RosterModel::addItemRequested, this, &RosterModel::addItem);
-	connect(this, &RosterModel::addItemRequested, RosterDb::instance(), &RosterDb::addItem);
 
 	connect(this, &RosterModel::updateItemRequested,
 	        this, &RosterModel::updateItem);
@@ -64,14 +68,14 @@ RosterModel::RosterModel(QObject *parent)
 
 	connect(this, &RosterModel::replaceItemsRequested,
 	        this, &RosterModel::replaceItems);
-	connect(this, &RosterModel::replaceItemsRequested, RosterDb::instance(), &RosterDb::replaceItems);
 
-	connect(MessageDb::instance(), &MessageDb::messageAdded,
-	        this, &RosterModel::handleMessageAdded);
+	connect(MessageDb::instance(), &MessageDb::messagesAdded,
+	        this, &RosterModel::handleMessagesAdded);
 
 	connect(AccountManager::instance(), &AccountManager::jidChanged, this, [=]() {
 		beginResetModel();
 		m_items.clear();
+		m_rowsByJid.clear();
 		endResetModel();
 
 		emit RosterDb::instance()->fetchItemsRequested(AccountManager::instance()->jid());
@@ -85,8 +89,6 @@ RosterModel::RosterModel(QObject *parent)
 		if (accountJid == MessageModel::instance()->currentAccountJid() && chatJid == MessageModel::instance()->currentChatJid())
 			emit Kaidan::instance()->openChatViewRequested();
 	});
-
-	connect(MessageDb::instance(), &MessageDb::messageAdded, this, &RosterModel::handleMessageAdded);
 }
 
 void RosterModel::setMessageModel(MessageModel *model)
@@ -117,6 +119,7 @@ QHash<int, QByteArray> RosterModel::roleNames() const
 	roles[LastExchangedRole] = "lastExchanged";
 	roles[UnreadMessagesRole] = "unreadMessages";
 	roles[LastMessageRole] = "lastMessage";
+	roles[SearchKeyRole] = "searchKey";
 	return roles;
 }
 
@@ -138,20 +141,25 @@ QVariant RosterModel::data(const QModelIndex &index, int role) const
 		return m_items.at(index.row()).unreadMessages();
 	case LastMessageRole:
 		return m_items.at(index.row()).lastMessage();
+	case SearchKeyRole:
+		return m_items.at(index.row()).searchKey();
 	}
 	return {};
 }
 
 std::optional<const RosterItem> RosterModel::findItem(const QString &jid) const
 {
-	for (const auto &item : qAsConst(m_items)) {
-		if (item.jid() == jid)
-			return item;
-	}
+	if (const int row = rowOfItem(jid); row != -1)
+		return m_items.at(row);
 
 	return std::nullopt;
 }
 
+int RosterModel::rowOfItem(const QString &jid) const
+{
+	return m_rowsByJid.value(jid, -1);
+}
+
 QString RosterModel::itemName(const QString &, const QString &jid) const
 {
 	if (auto item = findItem(jid))
@@ -159,199 +167,303 @@ QString RosterModel::itemName(const QString &, const QString &jid) const
 	return {};
 }
 
+QVector<QString> RosterModel::jidsByLastExchanged() const
+{
+	QVector<const RosterItem *> items;
+	items.reserve(m_items.size());
+	for (const auto &item : m_items)
+		items << &item;
+
+	// Items without a last exchanged message are at the end since a null stamp is the
+	// smallest one.
+	std::stable_sort(items.begin(), items.end(), [](const RosterItem *left, const RosterItem *right) {
+		return left->lastExchanged() > right->lastExchanged();
+	});
+
+	QVector<QString> jids;
+	jids.reserve(items.size());
+	for (const auto *item : qAsConst(items))
+		jids << item->jid();
+	return jids;
+}
+
 void RosterModel::handleItemsFetched(const QVector<RosterItem> &items)
 {
-	beginResetModel();
-	m_items = items;
-	std::sort(m_items.begin(), m_items.end());
-	endResetModel();
+	auto sortedItems = items;
+	std::sort(sortedItems.begin(), sortedItems.end());
+	applyItems(sortedItems);
 }
 
 void RosterModel::addItem(const RosterItem &item)
 {
+	if (const int row = rowOfItem(item.jid()); row != -1) {
+		m_items.replace(row, item);
+		emit dataChanged(index(row), index(row), {});
+		updateItemPosition(row);
+		return;
+	}
+
 	insertItem(positionToInsert(item), item);
 }
 
 void RosterModel::removeItem(const QString &jid)
 {
-	QMutableVectorIterator<RosterItem> itr(m_items);
-	int i = 0;
-	while (itr.hasNext()) {
-		if (itr.next().jid() == jid) {
-			beginRemoveRows(QModelIndex(), i, i);
-			itr.remove();
-			endRemoveRows();
-			return;
-		}
-		i++;
-	}
+	if (const int row = rowOfItem(jid); row != -1)
+		removeItemAt(row);
 }
 
 void RosterModel::updateItem(const QString &jid,
                              const std::function<void (RosterItem &)> &updateItem)
 {
-	for (int i = 0; i < m_items.length(); i++) {
-		if (m_items.at(i).jid() == jid) {
-			// update item
-			RosterItem item = m_items.at(i);
-			updateItem(item);
+	const int i = rowOfItem(jid);
+	if (i == -1)
+		return;
 
-			// check if item was actually modified
-			if (m_items.at(i) == item)
-				return;
+	// update item
+	RosterItem item = m_items.at(i);
+	updateItem(item);
 
-			m_items.replace(i, item);
+	// check if item was actually modified
+	if (m_items.at(i) == item)
+		return;
 
-			// item was changed: refresh all roles
-			emit dataChanged(index(i), index(i), {});
+	m_items.replace(i, item);
 
-			// check, if the position of the new item may be different
-			updateItemPosition(i);
-			return;
-		}
-	}
+	// item was changed: refresh all roles
+	emit dataChanged(index(i), index(i), {});
+
+	// check, if the position of the new item may be different
+	updateItemPosition(i);
 }
 
 void RosterModel::replaceItems(const QHash<QString, RosterItem> &items)
 {
 	QVector<RosterItem> newItems;
-	for (auto item : qAsConst(items)) {
-		// find old item
-		auto oldItem = std::find_if(
-			m_items.begin(),
-			m_items.end(),
-			[&] (const RosterItem &oldItem) {
-				return oldItem.jid() == item.jid();
-			}
-		);
+	newItems.reserve(items.size());
 
+	for (auto item : qAsConst(items)) {
 		// use the old item's values, if found
-		if (oldItem != m_items.end()) {
-			item.setLastMessage(oldItem->lastMessage());
-			item.setLastExchanged(oldItem->lastExchanged());
-			item.setUnreadMessages(oldItem->unreadMessages());
+		if (const int row = rowOfItem(item.jid()); row != -1) {
+			const auto &oldItem = m_items.at(row);
+			item.setLastMessage(oldItem.lastMessage());
+			item.setLastExchanged(oldItem.lastExchanged());
+			item.setUnreadMessages(oldItem.unreadMessages());
 		}
 
 		newItems << item;
 	}
 
-	// replace all items
-	handleItemsFetched(newItems);
+	std::sort(newItems.begin(), newItems.end());
+	applyItems(newItems);
 }
 
 void RosterModel::removeItems(const QString &accountJid, const QString &jid)
 {
-	for (int i = 0; i < m_items.size(); i++) {
-		RosterItem &item = m_items[i];
+	if (AccountManager::instance()->jid() != accountJid)
+		return;
 
-		if (AccountManager::instance()->jid() == accountJid && (item.jid().isEmpty() || item.jid() == jid)) {
-			beginRemoveRows(QModelIndex(), i, i);
-			m_items.remove(i);
-			endRemoveRows();
-			return;
-		}
+	if (jid.isEmpty()) {
+		beginResetModel();
+		m_items.clear();
+		m_rowsByJid.clear();
+		endResetModel();
+	} else {
+		removeItem(jid);
 	}
 }
 
-void RosterModel::handleMessageAdded(const Message &message, MessageOrigin origin)
+void RosterModel::handleMessagesAdded(const QVector<AddedMessage> &messages)
 {
-	const auto contactJid = message.isOwn() ? message.to() : message.from();
-	auto itr = std::find_if(m_items.begin(), m_items.end(), [&contactJid](const RosterItem &item) {
-		return item.jid() == contactJid;
-	});
+	// The changes are collected per roster item so that each one is updated only once.
+	QHash<QString, QVector<int>> changedRolesOfItems;
 
-	// contact not found
-	if (itr == m_items.end())
-		return;
+	const auto addChangedRole = [](QVector<int> &changedRoles, int role) {
+		if (!changedRoles.contains(role))
+			changedRoles << role;
+	};
 
-	// only set new message if it's newer
-	// allow setting old message if the current message is empty
-	if (!itr->lastMessage().isEmpty() && itr->lastExchanged() >= message.stamp())
-		return;
+	for (const auto &[message, origin] : messages) {
+		const auto contactJid = message.isOwn() ? message.to() : message.from();
+		const int row = rowOfItem(contactJid);
 
-	QVector<int> changedRoles = {
-		int(LastExchangedRole)
-	};
+		// contact not found
+		if (row == -1)
+			continue;
 
-	// last exchanged
-	itr->setLastExchanged(message.stamp());
+		auto itr = m_items.begin() + row;
 
-	// last message
-	const auto lastMessage = message.previewText();
-	if (itr->lastMessage() != lastMessage) {
-		itr->setLastMessage(lastMessage);
-		changedRoles << int(LastMessageRole);
-	}
+		// only set new message if it's newer
+		// allow setting old message if the current message is empty
+		if (!itr->lastMessage().isEmpty() && itr->lastExchanged() >= message.stamp())
+			continue;
 
-	// unread messages counter
-	std::optional<int> newUnreadMessages;
-	if (message.isOwn()) {
-		// if we sent a message (with another device), reset counter
-		newUnreadMessages = 0;
-	} else if (MessageModel::instance()->currentChatJid() != contactJid) {
-		// increase counter, if chat isn't open and message is new
-		switch (origin) {
-		case MessageOrigin::Stream:
-		case MessageOrigin::UserInput:
-		case MessageOrigin::MamCatchUp:
-			newUnreadMessages = itr->unreadMessages() + 1;
-		case MessageOrigin::MamBacklog:
-		case MessageOrigin::MamInitial:
-			break;
+		auto &changedRoles = changedRolesOfItems[contactJid];
+
+		// last exchanged
+		itr->setLastExchanged(message.stamp());
+		addChangedRole(changedRoles, LastExchangedRole);
+
+		// last message
+		const auto lastMessage = message.previewText();
+		if (itr->lastMessage() != lastMessage) {
+			itr->setLastMessage(lastMessage);
+			addChangedRole(changedRoles, LastMessageRole);
 		}
-	}
 
-	if (newUnreadMessages.has_value()) {
-		itr->setUnreadMessages(*newUnreadMessages);
-		changedRoles << int(UnreadMessagesRole);
+		// unread messages counter
+		std::optional<int> newUnreadMessages;
+		if (message.isOwn()) {
+			// if we sent a message (with another device), reset counter
+			newUnreadMessages = 0;
+		} else if (MessageModel::instance()->currentChatJid() != contactJid) {
+			// increase counter, if chat isn't open and message is new
+			switch (origin) {
+			case MessageOrigin::Stream:
+			case MessageOrigin::UserInput:
+			case MessageOrigin::MamCatchUp:
+				newUnreadMessages = itr->unreadMessages() + 1;
+			case MessageOrigin::MamBacklog:
+			case MessageOrigin::MamInitial:
+				break;
+			}
+		}
 
-		emit RosterDb::instance()->updateItemRequested(contactJid, [=](RosterItem &item) {
-			item.setUnreadMessages(*newUnreadMessages);
-		});
+		if (newUnreadMessages.has_value()) {
+			itr->setUnreadMessages(*newUnreadMessages);
+			addChangedRole(changedRoles, UnreadMessagesRole);
+		}
 	}
 
-	// notify gui
-	const auto i = std::distance(m_items.begin(), itr);
-	const auto modelIndex = index(i);
-	emit dataChanged(modelIndex, modelIndex, changedRoles);
+	for (auto itr = changedRolesOfItems.cbegin(); itr != changedRolesOfItems.cend(); ++itr) {
+		const auto &jid = itr.key();
+		const auto &changedRoles = itr.value();
+		const int i = rowOfItem(jid);
 
-	// move row to correct position
-	updateItemPosition(i);
+		if (changedRoles.contains(UnreadMessagesRole)) {
+			const auto unreadMessages = m_items.at(i).unreadMessages();
+			emit RosterDb::instance()->updateItemRequested(jid, [=](RosterItem &item) {
+				item.setUnreadMessages(unreadMessages);
+			});
+		}
+
+		// notify gui
+		const auto modelIndex = index(i);
+		emit dataChanged(modelIndex, modelIndex, changedRoles);
+
+		// move row to correct position
+		updateItemPosition(i);
+	}
+}
+
+void RosterModel::updateRowIndex(int firstRow, int lastRow)
+{
+	for (int row = firstRow; row <= lastRow; row++)
+		m_rowsByJid.insert(m_items.at(row).jid(), row);
 }
 
 void RosterModel::insertItem(int index, const RosterItem &item)
 {
 	beginInsertRows(QModelIndex(), index, index);
 	m_items.insert(index, item);
+	updateRowIndex(index, m_items.size() - 1);
 	endInsertRows();
 }
 
-int RosterModel::updateItemPosition(int currentPosition)
+void RosterModel::removeItemAt(int row)
+{
+	beginRemoveRows(QModelIndex(), row, row);
+	m_rowsByJid.remove(m_items.at(row).jid());
+	m_items.remove(row);
+	updateRowIndex(row, m_items.size() - 1);
+	endRemoveRows();
+}
+
+void RosterModel::moveItem(int currentRow, int newRow)
 {
-	const int newPosition = positionToInsert(m_items.at(currentPosition));
-	if (currentPosition == newPosition)
-		return currentPosition;
+	if (currentRow == newRow)
+		return;
 
-	beginMoveRows(QModelIndex(), currentPosition, currentPosition, QModelIndex(), newPosition);
-	m_items.move(currentPosition, newPosition);
+	// The destination of beginMoveRows() is the row before which the item is moved.
+	beginMoveRows(QModelIndex(), currentRow, currentRow, QModelIndex(), newRow > currentRow ? newRow + 1 : newRow);
+	m_items.move(currentRow, newRow);
+	updateRowIndex(std::min(currentRow, newRow), std::max(currentRow, newRow));
 	endMoveRows();
+}
 
+int RosterModel::updateItemPosition(int currentPosition)
+{
+	const int newPosition = positionToInsert(m_items.at(currentPosition), currentPosition);
+	moveItem(currentPosition, newPosition);
 	return newPosition;
 }
 
-int RosterModel::positionToInsert(const RosterItem &item)
+int RosterModel::positionToInsert(const RosterItem &item, int ignoredRow)
 {
 	// prepend the item, if no timestamp is set
 	if (item.lastExchanged().isNull())
 		return 0;
 
+	int position = 0;
 	for (int i = 0; i < m_items.size(); i++) {
+		if (i == ignoredRow)
+			continue;
+
 		if (item <= m_items.at(i))
-			return i;
+			return position;
+
+		position++;
 	}
 
 	// append
-	return m_items.size();
+	return position;
+}
+
+void RosterModel::applyItems(const QVector<RosterItem> &items)
+{
+	QSet<QString> newJids;
+	newJids.reserve(items.size());
+	for (const auto &item : items)
+		newJids.insert(item.jid());
+
+	// Remove the items which are not contained anymore in ranges of adjacent rows.
+	for (int lastRow = m_items.size() - 1; lastRow >= 0; lastRow--) {
+		if (newJids.contains(m_items.at(lastRow).jid()))
+			continue;
+
+		int firstRow = lastRow;
+		while (firstRow > 0 && !newJids.contains(m_items.at(firstRow - 1).jid()))
+			firstRow--;
+
+		beginRemoveRows(QModelIndex(), firstRow, lastRow);
+		for (int row = firstRow; row <= lastRow; row++)
+			m_rowsByJid.remove(m_items.at(row).jid());
+		m_items.remove(firstRow, lastRow - firstRow + 1);
+		updateRowIndex(firstRow, m_items.size() - 1);
+		endRemoveRows();
+
+		lastRow = firstRow;
+	}
+
+	// Move the existing items to their new rows and insert the new items. The rows before
+	// the current one are already in their final order.
+	QVector<int> changedRows;
+	for (int newRow = 0; newRow < items.size(); newRow++) {
+		const auto &item = items.at(newRow);
+
+		if (const int currentRow = rowOfItem(item.jid()); currentRow == -1) {
+			insertItem(newRow, item);
+		} else {
+			moveItem(currentRow, newRow);
+
+			if (m_items.at(newRow) != item) {
+				m_items.replace(newRow, item);
+				changedRows << newRow;
+			}
+		}
+	}
+
+	for (const auto row : qAsConst(changedRows))
+		emit dataChanged(index(row), index(row), {});
 }
 
 QString RosterModel::determineItemName(const QString &jid, const QString &name) const
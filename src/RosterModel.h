@@ -34,14 +34,14 @@
 #include <optional>
 // Qt
 #include <QAbstractListModel>
+#include <QHash>
 #include <QVector>
 // Kaidan
+#include "Message.h"
 #include "RosterItem.h"
 
 class Kaidan;
 class MessageModel;
-class Message;
-enum class MessageOrigin : quint8;
 
 class RosterModel : public QAbstractListModel
 {
@@ -54,6 +54,7 @@ public:
 		LastExchangedRole,
 		UnreadMessagesRole,
 		LastMessageRole,
+		SearchKeyRole,
 	};
 
 	static RosterModel *instance();
@@ -79,6 +80,12 @@ public:
 	 */
 	Q_INVOKABLE QString itemName(const QString &accountJid, const QString &jid) const;
 
+	/**
+	 * Returns the JIDs of all roster items ordered by the stamps of their last exchanged
+	 * messages, starting with the most recent one.
+	 */
+	QVector<QString> jidsByLastExchanged() const;
+
 signals:
 	void addItemRequested(const RosterItem &item);
 	void removeItemRequested(const QString &jid);
@@ -116,7 +123,13 @@ private slots:
 	 */
 	void removeItems(const QString &accountJid, const QString &jid = {});
 
-	void handleMessageAdded(const Message &message, MessageOrigin origin);
+	/**
+	 * Updates the last messages and unread message counters by a batch of messages
+	 * added to the database.
+	 *
+	 * @param messages added messages in the order they were added
+	 */
+	void handleMessagesAdded(const QVector<AddedMessage> &messages);
 
 private:
 	/**
@@ -124,9 +137,33 @@ private:
 	 */
 	std::optional<const RosterItem> findItem(const QString &jid) const;
 
+	/**
+	 * Returns the row of the roster item with a given JID or -1 if there is no such item.
+	 */
+	int rowOfItem(const QString &jid) const;
+
+	/**
+	 * Updates the rows of the items between two rows (including both) in the JID index.
+	 */
+	void updateRowIndex(int firstRow, int lastRow);
+
 	void insertItem(int index, const RosterItem &item);
+	void removeItemAt(int row);
+	void moveItem(int currentRow, int newRow);
 	int updateItemPosition(int currentIndex);
-	int positionToInsert(const RosterItem &item);
+
+	/**
+	 * Determines the position of an item which is not in the model or which is ignored at
+	 * its current row.
+	 */
+	int positionToInsert(const RosterItem &item, int ignoredRow = -1);
+
+	/**
+	 * Changes the items to the given ones with as few row operations as possible.
+	 *
+	 * @param items new items in sorted order
+	 */
+	void applyItems(const QVector<RosterItem> &items);
 
 	/**
 	 * Determines a suitable roster item's name.
@@ -140,6 +177,8 @@ private:
 	QString determineItemName(const QString &jid, const QString &name) const;
 
 	QVector<RosterItem> m_items;
+	// rows of the items by their JIDs
+	QHash<QString, int> m_rowsByJid;
 
 	static RosterModel *s_instance;
 };
@@ -0,0 +1,225 @@
+/*
+ *  Kaidan - A user-friendly XMPP client for every device!
+ *
+ *  Copyright (C) 2016-2021 Kaidan developers and contributors
+ *  (see the LICENSE file for a full list of copyright authors)
+ *
+ *  Kaidan is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  In addition, as a special exception, the author of Kaidan gives
+ *  permission to link the code of its release with the OpenSSL
+ *  project's "OpenSSL" library (or with modified versions of it that
+ *  use the same license as the "OpenSSL" library), and distribute the
+ *  linked executables. You must obey the GNU General Public License in
+ *  all respects for all of the code used other than "OpenSSL". If you
+ *  modify this file, you may extend this exception to your version of
+ *  the file, but you are not obligated to do so.  If you do not wish to
+ *  do so, delete this exception statement from your version.
+ *
+ *  Kaidan is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Kaidan.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "RosterVersioningExtension.h"
+
+// Qt
+#include <QDebug>
+#include <QDomDocument>
+#include <QDomElement>
+#include <QXmlStreamWriter>
+// QXmpp
+#include <QXmppClient.h>
+#include <QXmppRosterManager.h>
+#include <QXmppUtils.h>
+// Kaidan
+#include "StreamTracker.h"
+
+RosterVersioningExtension::RosterVersioningExtension(QXmppRosterManager *rosterManager, StreamTracker *streamTracker)
+	: m_rosterManager(rosterManager),
+	  m_streamTracker(streamTracker)
+{
+}
+
+bool RosterVersioningExtension::isRosterReceived() const
+{
+	return m_isRosterReceived;
+}
+
+void RosterVersioningExtension::setStoredRoster(const QXmppRosterIq &roster)
+{
+	if (m_isRosterReceived)
+		return;
+
+	m_items.clear();
+
+	const auto items = roster.items();
+	for (const auto &item : items)
+		m_items.insert(item.bareJid(), item);
+
+	m_version = roster.version();
+	m_isStoredRosterSet = true;
+	m_isStoredRosterLoaded = true;
+
+	if (m_isRosterRequestPending) {
+		m_isRosterRequestPending = false;
+		requestRoster();
+	}
+}
+
+bool RosterVersioningExtension::handleStanza(const QDomElement &element)
+{
+	if (element.tagName() != QStringLiteral("iq") || !QXmppRosterIq::isRosterIq(element))
+		return false;
+
+	if (!m_requestId.isEmpty() && element.attribute(QStringLiteral("id")) == m_requestId) {
+		m_requestId.clear();
+		handleRosterResult(element);
+		return true;
+	}
+
+	if (element.attribute(QStringLiteral("type")) == QStringLiteral("set"))
+		handleRosterPush(element);
+
+	// Pushes are handled by the QXmppRosterManager as well.
+	return false;
+}
+
+void RosterVersioningExtension::setClient(QXmppClient *client)
+{
+	QXmppClientExtension::setClient(client);
+
+	// The roster is requested by this extension instead of the QXmppRosterManager.
+	if (!disconnect(client, &QXmppClient::connected, m_rosterManager, nullptr))
+		qWarning() << "[client] [RosterVersioningExtension] QXmppRosterManager does not request the roster on connecting anymore";
+
+	connect(client, &QXmppClient::connected, this, &RosterVersioningExtension::handleConnected);
+	connect(client, &QXmppClient::disconnected, this, &RosterVersioningExtension::handleDisconnected);
+}
+
+void RosterVersioningExtension::handleConnected()
+{
+	// The server sends the pushes missed while being disconnected via the resumed stream.
+	// The QXmppRosterManager cleared its entries on disconnecting and only needs the
+	// current roster again.
+	if (m_streamTracker->isStreamResumed() && m_isStoredRosterSet) {
+		m_isRosterRequestPending = false;
+		passRosterToManager();
+		emit rosterReceived();
+		return;
+	}
+
+	// The roster is requested after the stored roster was set so that the stored roster
+	// cannot replace the received one.
+	if (m_isStoredRosterLoaded)
+		requestRoster();
+	else
+		m_isRosterRequestPending = true;
+}
+
+void RosterVersioningExtension::handleDisconnected()
+{
+	// The stored roster is loaded again for the next connection. The current roster is
+	// kept in case the stream is resumed.
+	m_requestId.clear();
+	m_isRosterRequestPending = false;
+	m_isRosterReceived = false;
+	m_isStoredRosterLoaded = false;
+}
+
+void RosterVersioningExtension::requestRoster()
+{
+	QXmppRosterIq request;
+	request.setType(QXmppIq::Get);
+	request.setFrom(client()->configuration().jid());
+
+	// Without a stored roster, the whole roster is requested. The version must not be
+	// sent if the server does not support roster versioning.
+	if (m_isStoredRosterSet && m_streamTracker->isRosterVersioningSupported())
+		request.setVersion(m_version);
+
+	m_requestId = request.id();
+	client()->sendPacket(request);
+}
+
+void RosterVersioningExtension::handleRosterResult(const QDomElement &element)
+{
+	QXmppRosterIq result;
+	result.parse(element);
+
+	if (result.type() == QXmppIq::Error) {
+		// Request the whole roster if the version was not accepted.
+		if (m_isStoredRosterSet) {
+			m_isStoredRosterSet = false;
+			requestRoster();
+		}
+		return;
+	}
+
+	// An empty result means that the stored roster is still up to date. The changes are
+	// sent as pushes afterwards.
+	if (!element.firstChildElement(QStringLiteral("query")).isNull()) {
+		m_items.clear();
+
+		const auto items = result.items();
+		for (const auto &item : items)
+			m_items.insert(item.bareJid(), item);
+
+		m_version = result.version();
+		m_isStoredRosterSet = true;
+
+		emit fullRosterReceived(result);
+	}
+
+	passRosterToManager();
+	emit rosterReceived();
+}
+
+void RosterVersioningExtension::handleRosterPush(const QDomElement &element)
+{
+	QXmppRosterIq push;
+	push.parse(element);
+
+	// Only pushes from the user's server are valid.
+	if (!push.from().isEmpty() && QXmppUtils::jidToBareJid(push.from()) != client()->configuration().jidBare())
+		return;
+
+	const auto items = push.items();
+	for (const auto &item : items) {
+		if (item.subscriptionType() == QXmppRosterIq::Item::Remove)
+			m_items.remove(item.bareJid());
+		else
+			m_items.insert(item.bareJid(), item);
+	}
+
+	if (!push.version().isEmpty())
+		m_version = push.version();
+
+	emit rosterPushReceived(push);
+}
+
+void RosterVersioningExtension::passRosterToManager()
+{
+	QXmppRosterIq roster;
+	roster.setType(QXmppIq::Result);
+
+	for (const auto &item : qAsConst(m_items))
+		roster.addItem(item);
+
+	QString serializedRoster;
+	QXmlStreamWriter writer(&serializedRoster);
+	roster.toXml(&writer);
+
+	QDomDocument document;
+	if (!document.setContent(serializedRoster, true) || !m_rosterManager->handleStanza(document.documentElement()))
+		qWarning() << "[client] [RosterVersioningExtension] QXmppRosterManager did not accept the roster";
+
+	m_isRosterReceived = true;
+}
@@ -0,0 +1,140 @@
+/*
+ *  Kaidan - A user-friendly XMPP client for every device!
+ *
+ *  Copyright (C) 2016-2021 Kaidan developers and contributors
+ *  (see the LICENSE file for a full list of copyright authors)
+ *
+ *  Kaidan is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  In addition, as a special exception, the author of Kaidan gives
+ *  permission to link the code of its release with the OpenSSL
+ *  project's "OpenSSL" library (or with modified versions of it that
+ *  use the same license as the "OpenSSL" library), and distribute the
+ *  linked executables. You must obey the GNU General Public License in
+ *  all respects for all of the code used other than "OpenSSL". If you
+ *  modify this file, you may extend this exception to your version of
+ *  the file, but you are not obligated to do so.  If you do not wish to
+ *  do so, delete this exception statement from your version.
+ *
+ *  Kaidan is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Kaidan.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+// Qt
+#include <QMap>
+// QXmpp
+#include <QXmppClientExtension.h>
+#include <QXmppRosterIq.h>
+
+class QXmppRosterManager;
+class StreamTracker;
+
+/**
+ * @class RosterVersioningExtension Requests the roster with XEP-0237: Roster Versioning
+ *
+ * QXmppRosterManager always requests the whole roster after connecting. This extension
+ * replaces that request by one containing the version of the stored roster. If the roster
+ * did not change, the server only sends the changes as roster pushes. Otherwise, it sends
+ * the whole roster again. No roster is requested if the previous stream was resumed
+ * because the server sends the missed pushes itself.
+ *
+ * The roster used afterwards (the stored or the received one) is passed to the
+ * QXmppRosterManager so that its entries can be used as if it had requested the roster
+ * itself.
+ *
+ * The roster is only requested after the stored roster was set for the current
+ * connection. The version is only sent if the server advertises the support for roster
+ * versioning in its stream features.
+ *
+ * The extension must be inserted before the QXmppRosterManager.
+ *
+ * This relies on the behavior of the QXmppRosterManager of QXmpp 1.3 and 1.4: It requests
+ * the roster by a connection to QXmppClient::connected() which is removed by this
+ * extension. It adds the items of all roster results to its entries but only regards a
+ * roster as received if it requested it itself. Thus,
+ * QXmppRosterManager::isRosterReceived() and QXmppRosterManager::rosterReceived() must
+ * not be used. isRosterReceived() and rosterReceived() of this extension replace them.
+ * A warning is logged if QXmpp does not behave as expected anymore.
+ */
+class RosterVersioningExtension : public QXmppClientExtension
+{
+	Q_OBJECT
+
+public:
+	RosterVersioningExtension(QXmppRosterManager *rosterManager, StreamTracker *streamTracker);
+
+	/**
+	 * Returns whether the roster was received or confirmed by the server after the last
+	 * connection.
+	 */
+	bool isRosterReceived() const;
+
+	/**
+	 * Sets the stored roster whose version is used for the next roster request.
+	 *
+	 * The stored roster is ignored if the roster was already received after the last
+	 * connection because it is older than the received one.
+	 */
+	void setStoredRoster(const QXmppRosterIq &roster);
+
+	bool handleStanza(const QDomElement &element) override;
+
+signals:
+	/**
+	 * Emitted when the roster was received or confirmed by the server.
+	 */
+	void rosterReceived();
+
+	/**
+	 * Emitted when the server sent the whole roster which replaces the stored one.
+	 *
+	 * @param roster received roster including its version
+	 */
+	void fullRosterReceived(const QXmppRosterIq &roster);
+
+	/**
+	 * Emitted when the roster was changed by a roster push.
+	 *
+	 * @param push roster push containing the changed items and the new version
+	 */
+	void rosterPushReceived(const QXmppRosterIq &push);
+
+protected:
+	void setClient(QXmppClient *client) override;
+
+private:
+	void handleConnected();
+	void handleDisconnected();
+	void requestRoster();
+	void handleRosterResult(const QDomElement &element);
+	void handleRosterPush(const QDomElement &element);
+
+	/**
+	 * Passes the current roster to the QXmppRosterManager as if it was the result of a
+	 * request and marks the roster as received.
+	 */
+	void passRosterToManager();
+
+	QXmppRosterManager *m_rosterManager;
+	StreamTracker *m_streamTracker;
+
+	// current roster kept up to date by roster results and pushes
+	QMap<QString, QXmppRosterIq::Item> m_items;
+	QString m_version;
+	bool m_isStoredRosterSet = false;
+	bool m_isStoredRosterLoaded = false;
+
+	QString m_requestId;
+	bool m_isRosterRequestPending = false;
+	bool m_isRosterReceived = false;
+};
@@ -0,0 +1,190 @@
+/*
+ *  Kaidan - A user-friendly XMPP client for every device!
+ *
+ *  Copyright (C) 2016-2021 Kaidan developers and contributors
+ *  (see the LICENSE file for a full list of copyright authors)
+ *
+ *  Kaidan is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  In addition, as a special exception, the author of Kaidan gives
+ *  permission to link the code of its release with the OpenSSL
+ *  project's "OpenSSL" library (or with modified versions of it that
+ *  use the same license as the "OpenSSL" library), and distribute the
+ *  linked executables. You must obey the GNU General Public License in
+ *  all respects for all of the code used other than "OpenSSL". If you
+ *  modify this file, you may extend this exception to your version of
+ *  the file, but you are not obligated to do so.  If you do not wish to
+ *  do so, delete this exception statement from your version.
+ *
+ *  Kaidan is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Kaidan.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "StreamTracker.h"
+
+// Qt
+#include <QRegularExpression>
+// QXmpp
+#include <QXmppClient.h>
+
+// Stream Management elements received from the server
+static const QRegularExpression s_streamManagementElementRegExp(
+	QStringLiteral(R"(<(enabled|failed|a|resumed)\b[^>]*\bxmlns=['"]urn:xmpp:sm:3['"][^>]*>)"));
+static const QRegularExpression s_handledStanzasRegExp(QStringLiteral(R"(\bh=['"](\d+)['"])"));
+static const QRegularExpression s_resumptionRegExp(QStringLiteral(R"(\bresume=['"](true|1)['"])"));
+
+// Entity Capabilities element in the server's stream features
+static const QRegularExpression s_capsElementRegExp(
+	QStringLiteral(R"(<c\b[^>]*\bxmlns=['"]http://jabber\.org/protocol/caps['"][^>]*>)"));
+static const QRegularExpression s_capsHashRegExp(QStringLiteral(R"(\bhash=['"]([^'"]+)['"])"));
+static const QRegularExpression s_capsVerificationStringRegExp(QStringLiteral(R"(\bver=['"]([^'"]+)['"])"));
+
+// Roster Versioning element in the server's stream features
+static const QRegularExpression s_rosterVersioningFeatureRegExp(
+	QStringLiteral(R"(<ver\b[^>]*\bxmlns=['"]urn:xmpp:features:rosterver['"])"));
+
+StreamTracker::StreamTracker(QXmppClient *client, QObject *parent)
+	: QObject(parent)
+{
+	setUpLogger(client->logger());
+	connect(client, &QXmppClient::loggerChanged, this, &StreamTracker::setUpLogger);
+}
+
+StreamTracker::~StreamTracker() = default;
+
+bool StreamTracker::isEnabled() const
+{
+	return m_isEnabled;
+}
+
+bool StreamTracker::isResumptionPossible() const
+{
+	return m_isResumptionPossible;
+}
+
+bool StreamTracker::isStreamResumed() const
+{
+	return m_isStreamResumed;
+}
+
+quint32 StreamTracker::sentStanzas() const
+{
+	return m_sentStanzas;
+}
+
+QString StreamTracker::serverVerificationString() const
+{
+	return m_serverVerificationString;
+}
+
+bool StreamTracker::isRosterVersioningSupported() const
+{
+	return m_isRosterVersioningSupported;
+}
+
+void StreamTracker::setUpLogger(QXmppLogger *logger)
+{
+	if (m_logger)
+		disconnect(m_logger, &QXmppLogger::message, this, &StreamTracker::handleLog);
+
+	m_logger = logger;
+
+	if (!m_logger)
+		return;
+
+	// The logged data is only emitted by QXmppLogger::message() with signal logging.
+	m_logger->setLoggingType(QXmppLogger::SignalLogging);
+	m_logger->setMessageTypes(m_logger->messageTypes() | QXmppLogger::SentMessage | QXmppLogger::ReceivedMessage);
+
+	connect(m_logger, &QXmppLogger::message, this, &StreamTracker::handleLog);
+}
+
+void StreamTracker::handleLog(QXmppLogger::MessageType type, const QString &text)
+{
+	if (type == QXmppLogger::SentMessage) {
+		const QStringView data(text);
+		if (data.startsWith(QLatin1String("<message")) || data.startsWith(QLatin1String("<iq"))
+		    || data.startsWith(QLatin1String("<presence"))) {
+			m_sentStanzas++;
+		} else if (data.startsWith(QLatin1String("<enable"))) {
+			// the server counts the stanzas from here on
+			m_sentStanzas = 0;
+		} else if (data.startsWith(QLatin1String("</stream:stream>"))) {
+			// the stream is closed intentionally and cannot be resumed anymore
+			m_isResumptionPossible = false;
+		} else if (data.startsWith(QLatin1String("<?xml")) || data.startsWith(QLatin1String("<stream:stream"))) {
+			// a new connection is being established with new stream features
+			m_isEnabled = false;
+			m_isResumptionPossible = false;
+			m_isStreamResumed = false;
+			m_serverVerificationString.clear();
+			m_isRosterVersioningSupported = false;
+		}
+		return;
+	}
+
+	if (type != QXmppLogger::ReceivedMessage)
+		return;
+
+	// A logged text may contain multiple elements.
+	if (text.contains(QLatin1String("stream:features")))
+		handleStreamFeatures(text);
+	if (text.contains(QLatin1String("urn:xmpp:sm:3")))
+		handleStreamManagementElements(text);
+}
+
+void StreamTracker::handleStreamFeatures(const QString &text)
+{
+	if (s_rosterVersioningFeatureRegExp.match(text).hasMatch())
+		m_isRosterVersioningSupported = true;
+
+	if (const auto match = s_capsElementRegExp.match(text); match.hasMatch()) {
+		const auto element = match.capturedRef(0);
+		if (s_capsHashRegExp.match(element).capturedRef(1) == QLatin1String("sha-1"))
+			m_serverVerificationString = s_capsVerificationStringRegExp.match(element).captured(1);
+	}
+}
+
+void StreamTracker::handleStreamManagementElements(const QString &text)
+{
+	auto matches = s_streamManagementElementRegExp.globalMatch(text);
+	while (matches.hasNext()) {
+		const auto match = matches.next();
+		const auto element = match.capturedRef(0);
+		const auto elementName = match.capturedRef(1);
+
+		if (elementName == QLatin1String("enabled")) {
+			m_isEnabled = true;
+			m_isResumptionPossible = s_resumptionRegExp.match(element).hasMatch();
+			m_isStreamResumed = false;
+		} else if (elementName == QLatin1String("failed")) {
+			// Either the stream could not be resumed and a new one is established or
+			// Stream Management could not be enabled at all.
+			m_isEnabled = false;
+			m_isResumptionPossible = false;
+			m_isStreamResumed = false;
+			emit failed();
+		} else if (const auto handledStanzasMatch = s_handledStanzasRegExp.match(element); handledStanzasMatch.hasMatch()) {
+			const auto handledStanzas = handledStanzasMatch.capturedRef(1).toUInt();
+
+			// Stanzas that were not acknowledged before are sent again after resuming
+			// the stream and counted again.
+			if (elementName == QLatin1String("resumed")) {
+				m_isEnabled = true;
+				m_isResumptionPossible = true;
+				m_isStreamResumed = true;
+				m_sentStanzas = handledStanzas;
+			}
+
+			emit acknowledged(handledStanzas);
+		}
+	}
+}
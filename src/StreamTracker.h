@@ -0,0 +1,135 @@
+/*
+ *  Kaidan - A user-friendly XMPP client for every device!
+ *
+ *  Copyright (C) 2016-2021 Kaidan developers and contributors
+ *  (see the LICENSE file for a full list of copyright authors)
+ *
+ *  Kaidan is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  In addition, as a special exception, the author of Kaidan gives
+ *  permission to link the code of its release with the OpenSSL
+ *  project's "OpenSSL" library (or with modified versions of it that
+ *  use the same license as the "OpenSSL" library), and distribute the
+ *  linked executables. You must obey the GNU General Public License in
+ *  all respects for all of the code used other than "OpenSSL". If you
+ *  modify this file, you may extend this exception to your version of
+ *  the file, but you are not obligated to do so.  If you do not wish to
+ *  do so, delete this exception statement from your version.
+ *
+ *  Kaidan is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Kaidan.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+// Qt
+#include <QObject>
+#include <QPointer>
+// QXmpp
+#include <QXmppLogger.h>
+
+class QXmppClient;
+
+/**
+ * @class StreamTracker Tracker of the state of the stream
+ *
+ * QXmpp handles Stream Management (XEP-0198) and the stream features internally without
+ * providing their state. Thus, the stanzas sent, the Stream Management elements received
+ * and the stream features are tracked by the client's log.
+ *
+ * This is the only component parsing the client's log. It configures the client's
+ * logger to emit the sent and received data so that the tracking does not depend on
+ * the logging of the user interface.
+ */
+class StreamTracker : public QObject
+{
+	Q_OBJECT
+
+public:
+	explicit StreamTracker(QXmppClient *client, QObject *parent = nullptr);
+	~StreamTracker();
+
+	/**
+	 * Returns whether Stream Management is enabled for the current stream.
+	 */
+	bool isEnabled() const;
+
+	/**
+	 * Returns whether the server allows the current stream to be resumed after a
+	 * connection loss.
+	 */
+	bool isResumptionPossible() const;
+
+	/**
+	 * Returns whether the current stream is a resumed one.
+	 *
+	 * In that case, the state of the previous connection (e.g. the roster and presences)
+	 * is still valid and stanzas received in the meantime are delivered by the server.
+	 */
+	bool isStreamResumed() const;
+
+	/**
+	 * Returns the number of stanzas sent via the current stream as counted by the
+	 * server.
+	 */
+	quint32 sentStanzas() const;
+
+	/**
+	 * Returns the server's verification string (XEP-0115: Entity Capabilities) from the
+	 * features of the current stream.
+	 *
+	 * Only verification strings created by SHA-1 are provided since
+	 * QXmppDiscoveryIq::verificationString() only supports SHA-1.
+	 *
+	 * @return the Base64-encoded verification string or an empty string if the server
+	 * does not advertise one
+	 */
+	QString serverVerificationString() const;
+
+	/**
+	 * Returns whether the server advertises XEP-0237: Roster Versioning in the features
+	 * of the current stream.
+	 */
+	bool isRosterVersioningSupported() const;
+
+signals:
+	/**
+	 * Emitted when the server acknowledged the handling of stanzas.
+	 *
+	 * @param handledStanzas number of stanzas handled by the server since enabling
+	 * Stream Management
+	 */
+	void acknowledged(quint32 handledStanzas);
+
+	/**
+	 * Emitted when the server failed to resume the stream or to enable Stream
+	 * Management.
+	 *
+	 * Stanzas which were not acknowledged before are sent again by QXmpp via the new
+	 * stream without being counted as before.
+	 */
+	void failed();
+
+private:
+	void setUpLogger(QXmppLogger *logger);
+	void handleLog(QXmppLogger::MessageType type, const QString &text);
+	void handleStreamFeatures(const QString &text);
+	void handleStreamManagementElements(const QString &text);
+
+	bool m_isEnabled = false;
+	bool m_isResumptionPossible = false;
+	bool m_isStreamResumed = false;
+	quint32 m_sentStanzas = 0;
+	QString m_serverVerificationString;
+	bool m_isRosterVersioningSupported = false;
+
+	QPointer<QXmppLogger> m_logger;
+};
@@ -37,6 +37,7 @@
 #include <QXmppUtils.h>
 #include "qxmpp-exts/QXmppUploadManager.h"
 // Kaidan
+#include "DeliveryStateAggregator.h"
 #include "Kaidan.h"
 #include "MediaUtils.h"
 #include "MessageModel.h"
@@ -55,8 +56,8 @@ UploadManager::UploadManager(QXmppClient *client, RosterManager* rosterManager,
 
 	connect(this, &UploadManager::sendFileRequested, this, &UploadManager::sendFile);
 
-	connect(m_manager, &QXmppUploadManager::serviceFoundChanged, this, [=]() {
-		Kaidan::instance()->serverFeaturesCache()->setHttpUploadSupported(m_manager->serviceFound());
+	connect(m_manager, &QXmppUploadManager::uploadServiceChanged, this, [=]() {
+		Kaidan::instance()->serverFeaturesCache()->setHttpUploadSupported(!m_manager->uploadService().isEmpty());
 	});
 	connect(m_manager, &QXmppUploadManager::uploadSucceeded,
 	        this, &UploadManager::handleUploadSucceeded);
@@ -64,6 +65,11 @@ UploadManager::UploadManager(QXmppClient *client, RosterManager* rosterManager,
 	        this, &UploadManager::handleUploadFailed);
 }
 
+void UploadManager::handleDiscoInfo(const QXmppDiscoveryIq &info)
+{
+	m_manager->handleDiscoInfo(info);
+}
+
 void UploadManager::sendFile(const QString &jid, const QUrl &fileUrl, const QString &body)
 {
 	// TODO: Add offline media message cache and send when connnected again
@@ -134,16 +140,11 @@ void UploadManager::handleUploadSucceeded(const QXmppHttpUpload *upload)
 
 	bool success = m_client->sendPacket(m);
 	if (success) {
-		emit MessageModel::instance()->updateMessageRequested(originalMsg->id(), [](Message &msg) {
-			msg.setDeliveryState(Enums::DeliveryState::Sent);
-			msg.setErrorText({});
-		});
+		DeliveryStateAggregator::instance()->setDeliveryState(originalMsg->id(), Enums::DeliveryState::Sent);
 	} else {
 		emit Kaidan::instance()->passiveNotificationRequested(tr("Message could not be sent."));
-		emit MessageModel::instance()->updateMessageRequested(originalMsg->id(), [](Message &msg) {
-			msg.setDeliveryState(Enums::DeliveryState::Error);
-			msg.setErrorText(QStringLiteral("Message could not be sent."));
-		});
+		DeliveryStateAggregator::instance()->setDeliveryState(
+			originalMsg->id(), Enums::DeliveryState::Error, QStringLiteral("Message could not be sent."));
 	}
 
 	m_messages.remove(upload->id());
@@ -37,6 +37,7 @@
 class Message;
 class RosterManager;
 class QXmppClient;
+class QXmppDiscoveryIq;
 class QXmppHttpUpload;
 class QXmppUploadManager;
 
@@ -54,6 +55,11 @@ public:
 	UploadManager(QXmppClient *client, RosterManager* rosterManager,
 	              QObject* parent = nullptr);
 
+	/**
+	 * Handles service discovery info and uses the upload service if one was found.
+	 */
+	void handleDiscoInfo(const QXmppDiscoveryIq &info);
+
 signals:
 	/**
 	 * The upload progress of a file upload has changed
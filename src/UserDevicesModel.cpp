@@ -39,8 +39,6 @@
 UserDevicesModel::UserDevicesModel(QObject *parent)
 	: QAbstractListModel(parent)
 {
-	connect(PresenceCache::instance(), &PresenceCache::presenceChanged,
-	        this, &UserDevicesModel::handlePresenceChanged);
 	connect(PresenceCache::instance(), &PresenceCache::presencesCleared,
 	        this, &UserDevicesModel::handlePresencesCleared);
 	connect(this, &UserDevicesModel::clientVersionsRequested,
@@ -49,6 +47,12 @@ UserDevicesModel::UserDevicesModel(QObject *parent)
 		this, &UserDevicesModel::handleClientVersionReceived);
 }
 
+UserDevicesModel::~UserDevicesModel()
+{
+	if (auto *cache = PresenceCache::instance())
+		cache->unsubscribe(m_jid, this);
+}
+
 QHash<int, QByteArray> UserDevicesModel::roleNames() const
 {
 	return {
@@ -92,6 +96,9 @@ QString UserDevicesModel::jid() const
 
 void UserDevicesModel::setJid(const QString &jid)
 {
+	PresenceCache::instance()->unsubscribe(m_jid, this);
+	PresenceCache::instance()->subscribe(jid, this);
+
 	m_jid = jid;
 
 	// Clear data when jid of the model changes
@@ -136,11 +143,14 @@ void UserDevicesModel::handleClientVersionReceived(const QXmppVersionIq &version
 	}
 }
 
-void UserDevicesModel::handlePresenceChanged(PresenceCache::ChangeType type, const QString &jid, const QString &resource)
+void UserDevicesModel::handlePresencesChanged(const QVector<PresenceCache::Change> &changes)
 {
-	if (jid != m_jid)
-		return;
+	for (const auto &change : changes)
+		handlePresenceChanged(change.type, change.resource);
+}
 
+void UserDevicesModel::handlePresenceChanged(PresenceCache::ChangeType type, const QString &resource)
+{
 	switch(type) {
 	case PresenceCache::Connected:
 		beginInsertRows({}, m_devices.count(), m_devices.count());
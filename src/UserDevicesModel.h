@@ -37,7 +37,7 @@
 
 class QXmppVersionIq;
 
-class UserDevicesModel : public QAbstractListModel
+class UserDevicesModel : public QAbstractListModel, public PresenceCache::Subscriber
 {
 	Q_OBJECT
 
@@ -52,6 +52,7 @@ public:
 	};
 
 	explicit UserDevicesModel(QObject *parent = nullptr);
+	~UserDevicesModel() override;
 
 	QHash<int, QByteArray> roleNames() const override;
 	QVariant data(const QModelIndex &index, int role) const override;
@@ -66,12 +67,12 @@ signals:
 
 private slots:
 	void handleClientVersionReceived(const QXmppVersionIq &versionIq);
-	void handlePresenceChanged(PresenceCache::ChangeType type,
-	                           const QString &jid,
-	                           const QString &resource);
 	void handlePresencesCleared();
 
 private:
+	void handlePresencesChanged(const QVector<PresenceCache::Change> &changes) override;
+	void handlePresenceChanged(PresenceCache::ChangeType type, const QString &resource);
+
 	struct DeviceInfo {
 		DeviceInfo(const QString &resource);
 		DeviceInfo(const QXmppVersionIq &);
@@ -0,0 +1,138 @@
+/*
+ *  Kaidan - A user-friendly XMPP client for every device!
+ *
+ *  Copyright (C) 2016-2021 Kaidan developers and contributors
+ *  (see the LICENSE file for a full list of copyright authors)
+ *
+ *  Kaidan is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  In addition, as a special exception, the author of Kaidan gives
+ *  permission to link the code of its release with the OpenSSL
+ *  project's "OpenSSL" library (or with modified versions of it that
+ *  use the same license as the "OpenSSL" library), and distribute the
+ *  linked executables. You must obey the GNU General Public License in
+ *  all respects for all of the code used other than "OpenSSL". If you
+ *  modify this file, you may extend this exception to your version of
+ *  the file, but you are not obligated to do so.  If you do not wish to
+ *  do so, delete this exception statement from your version.
+ *
+ *  Kaidan is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Kaidan.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "VCardDb.h"
+// Qt
+#include <QDomDocument>
+#include <QSqlQuery>
+#include <QXmlStreamWriter>
+// Kaidan
+#include "Globals.h"
+#include "Utils.h"
+
+VCardDb *VCardDb::s_instance = nullptr;
+
+VCardDb::VCardDb(Database *db, QObject *parent)
+	: QObject(parent),
+	  m_db(db)
+{
+	Q_ASSERT(!VCardDb::s_instance);
+	s_instance = this;
+
+	connect(this, &VCardDb::fetchPhotoHashesRequested, this, &VCardDb::fetchPhotoHashes);
+	connect(this, &VCardDb::fetchVCardRequested, this, &VCardDb::fetchVCard);
+	connect(this, &VCardDb::addVCardRequested, this, &VCardDb::addVCard);
+	connect(this, &VCardDb::updatePhotoHashRequested, this, &VCardDb::updatePhotoHash);
+	connect(this, &VCardDb::removeVCardsRequested, this, &VCardDb::removeVCards);
+}
+
+VCardDb::~VCardDb()
+{
+	s_instance = nullptr;
+}
+
+VCardDb *VCardDb::instance()
+{
+	return s_instance;
+}
+
+void VCardDb::fetchPhotoHashes()
+{
+	QSqlQuery query(QSqlDatabase::database(DB_CONNECTION));
+	query.setForwardOnly(true);
+	Utils::execQuery(query, "SELECT jid, photoHash FROM " DB_TABLE_VCARDS);
+
+	QHash<QString, QString> photoHashes;
+	while (query.next())
+		photoHashes.insert(query.value(0).toString(), query.value(1).toString());
+
+	emit photoHashesFetched(photoHashes);
+}
+
+void VCardDb::fetchVCard(const QString &jid)
+{
+	QSqlQuery query(QSqlDatabase::database(DB_CONNECTION));
+	query.setForwardOnly(true);
+	Utils::execQuery(
+		query,
+		"SELECT vCard FROM " DB_TABLE_VCARDS " WHERE jid = ?",
+		QVector<QVariant>() << jid
+	);
+
+	if (!query.next())
+		return;
+
+	QDomDocument document;
+	if (!document.setContent(query.value(0).toString(), true))
+		return;
+
+	QXmppVCardIq vCard;
+	vCard.parse(document.documentElement());
+	vCard.setFrom(jid);
+
+	emit vCardFetched(jid, vCard);
+}
+
+void VCardDb::addVCard(const QString &jid, const QString &photoHash, const QXmppVCardIq &vCard)
+{
+	// The photo is stored by the AvatarFileStorage.
+	QXmppVCardIq storedVCard = vCard;
+	storedVCard.setPhoto({});
+	storedVCard.setFrom({});
+	storedVCard.setTo({});
+	storedVCard.setId({});
+
+	QString serializedVCard;
+	QXmlStreamWriter writer(&serializedVCard);
+	storedVCard.toXml(&writer);
+
+	QSqlQuery query(QSqlDatabase::database(DB_CONNECTION));
+	Utils::execQuery(
+		query,
+		"INSERT OR REPLACE INTO " DB_TABLE_VCARDS " (jid, photoHash, vCard) VALUES (?, ?, ?)",
+		QVector<QVariant>() << jid << photoHash << serializedVCard
+	);
+}
+
+void VCardDb::updatePhotoHash(const QString &jid, const QString &photoHash)
+{
+	QSqlQuery query(QSqlDatabase::database(DB_CONNECTION));
+	Utils::execQuery(
+		query,
+		"UPDATE " DB_TABLE_VCARDS " SET photoHash = ? WHERE jid = ?",
+		QVector<QVariant>() << photoHash << jid
+	);
+}
+
+void VCardDb::removeVCards()
+{
+	QSqlQuery query(QSqlDatabase::database(DB_CONNECTION));
+	Utils::execQuery(query, "DELETE FROM " DB_TABLE_VCARDS);
+}
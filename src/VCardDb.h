@@ -0,0 +1,117 @@
+/*
+ *  Kaidan - A user-friendly XMPP client for every device!
+ *
+ *  Copyright (C) 2016-2021 Kaidan developers and contributors
+ *  (see the LICENSE file for a full list of copyright authors)
+ *
+ *  Kaidan is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  In addition, as a special exception, the author of Kaidan gives
+ *  permission to link the code of its release with the OpenSSL
+ *  project's "OpenSSL" library (or with modified versions of it that
+ *  use the same license as the "OpenSSL" library), and distribute the
+ *  linked executables. You must obey the GNU General Public License in
+ *  all respects for all of the code used other than "OpenSSL". If you
+ *  modify this file, you may extend this exception to your version of
+ *  the file, but you are not obligated to do so.  If you do not wish to
+ *  do so, delete this exception statement from your version.
+ *
+ *  Kaidan is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Kaidan.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+// Qt
+#include <QHash>
+#include <QObject>
+// QXmpp
+#include <QXmppVCardIq.h>
+
+class Database;
+
+/**
+ * @class VCardDb The VCardDb stores the vCards (XEP-0054) of the user and the contacts.
+ *
+ * The photos are stored by the AvatarFileStorage. Only their hashes (XEP-0153) are stored
+ * together with the vCards to detect whether a vCard needs to be fetched again.
+ */
+class VCardDb : public QObject
+{
+	Q_OBJECT
+
+public:
+	VCardDb(Database *db, QObject *parent = nullptr);
+	~VCardDb();
+
+	static VCardDb *instance();
+
+signals:
+	void fetchPhotoHashesRequested();
+
+	/**
+	 * Emitted when the photo hashes of all stored vCards were fetched.
+	 *
+	 * @param photoHashes hex-encoded SHA-1 hashes of the photos (empty for vCards
+	 * without photos) mapped to the bare JIDs of the vCards
+	 */
+	void photoHashesFetched(const QHash<QString, QString> &photoHashes);
+
+	void fetchVCardRequested(const QString &jid);
+
+	/**
+	 * Emitted when a stored vCard was fetched.
+	 *
+	 * It is not emitted if there is no vCard stored for the requested JID.
+	 *
+	 * @param jid bare JID of the vCard
+	 * @param vCard stored vCard without its photo
+	 */
+	void vCardFetched(const QString &jid, const QXmppVCardIq &vCard);
+
+	void addVCardRequested(const QString &jid, const QString &photoHash, const QXmppVCardIq &vCard);
+	void updatePhotoHashRequested(const QString &jid, const QString &photoHash);
+	void removeVCardsRequested();
+
+public slots:
+	void fetchPhotoHashes();
+	void fetchVCard(const QString &jid);
+
+	/**
+	 * Stores a vCard or replaces the stored one.
+	 *
+	 * @param jid bare JID of the vCard
+	 * @param photoHash hex-encoded SHA-1 hash of the vCard's photo or an empty string
+	 * if it has no photo
+	 * @param vCard vCard to be stored
+	 */
+	void addVCard(const QString &jid, const QString &photoHash, const QXmppVCardIq &vCard);
+
+	/**
+	 * Updates the photo hash of a stored vCard (e.g. after a presence announced that the
+	 * photo was removed).
+	 *
+	 * @param jid bare JID of the vCard
+	 * @param photoHash hex-encoded SHA-1 hash of the vCard's photo or an empty string
+	 * if it has no photo
+	 */
+	void updatePhotoHash(const QString &jid, const QString &photoHash);
+
+	/**
+	 * Removes all stored vCards.
+	 */
+	void removeVCards();
+
+private:
+	Database *m_db;
+
+	static VCardDb *s_instance;
+};
@@ -30,25 +30,69 @@
 
 #include "VCardManager.h"
 
+#include <chrono>
+
+// Qt
+#include <QTimer>
 // QXmpp
 #include <QXmppUtils.h>
 #include <QXmppVCardManager.h>
 #include <QXmppVCardIq.h>
 // Kaidan
+#include "AccountManager.h"
 #include "AvatarFileStorage.h"
 #include "Kaidan.h"
+#include "MessageModel.h"
 #include "VCardCache.h"
+#include "VCardDb.h"
+#include "VCardRequestWatcher.h"
+
+using namespace std::chrono_literals;
+
+// Number of vCard requests running at once
+constexpr int VCARD_MAX_RUNNING_REQUESTS = 5;
+
+// Time after which a vCard request without a result is considered to be failed
+constexpr auto VCARD_REQUEST_TIMEOUT = 30s;
+
+// Interval for checking running vCard requests for timeouts
+constexpr auto VCARD_REQUEST_TIMEOUT_CHECK_INTERVAL = 5s;
 
 VCardManager::VCardManager(ClientWorker *clientWorker, QXmppClient *client, AvatarFileStorage *avatars, QObject *parent)
-	: QObject(parent), m_clientWorker(clientWorker), m_client(client), m_manager(client->findExtension<QXmppVCardManager>()), m_avatarStorage(avatars)
+	: QObject(parent), m_clientWorker(clientWorker), m_client(client), m_manager(client->findExtension<QXmppVCardManager>()), m_requestWatcher(new VCardRequestWatcher), m_avatarStorage(avatars), m_timeoutTimer(new QTimer(this))
 {
+	// The watcher is inserted before the QXmppVCardManager so that it sees all responses.
+	client->insertExtension(0, m_requestWatcher);
+
 	connect(m_manager, &QXmppVCardManager::vCardReceived, this, &VCardManager::handleVCardReceived);
+	connect(m_requestWatcher, &VCardRequestWatcher::requestFailed, this, &VCardManager::handleVCardUnavailable);
 	connect(m_client, &QXmppClient::presenceReceived, this, &VCardManager::handlePresenceReceived);
 	connect(m_manager, &QXmppVCardManager::clientVCardReceived, this, &VCardManager::handleClientVCardReceived);
 	connect(this, &VCardManager::vCardRequested, this, &VCardManager::requestVCard);
 	connect(this, &VCardManager::clientVCardRequested, this, &VCardManager::requestClientVCard);
 	connect(this, &VCardManager::changeNicknameRequested, this, &VCardManager::changeNickname);
 
+	connect(m_client, &QXmppClient::connected, this, &VCardManager::startRequests);
+	connect(m_client, &QXmppClient::disconnected, this, &VCardManager::handleDisconnected);
+
+	// request the vCard of the opened chat first
+	connect(MessageModel::instance(), &MessageModel::currentChatJidChanged, this, &VCardManager::prioritize);
+
+	m_timeoutTimer->setInterval(VCARD_REQUEST_TIMEOUT_CHECK_INTERVAL);
+	m_timeoutTimer->callOnTimeout(this, &VCardManager::handleTimeouts);
+
+	connect(VCardDb::instance(), &VCardDb::photoHashesFetched, this, &VCardManager::handlePhotoHashesFetched);
+	connect(VCardDb::instance(), &VCardDb::vCardFetched, this, &VCardManager::handleStoredVCardFetched);
+
+	emit VCardDb::instance()->fetchPhotoHashesRequested();
+
+	// Load the user's stored vCard (e.g. for the display name) while connecting.
+	connect(m_client, &QXmppClient::stateChanged, this, [this](QXmppClient::State state) {
+		const auto jid = AccountManager::instance()->jid();
+		if (state == QXmppClient::ConnectingState && !m_clientWorker->caches()->vCardCache->vCard(jid))
+			emit VCardDb::instance()->fetchVCardRequested(jid);
+	});
+
 	// Currently we're not requesting the own VCard on every connection because it is probably
 	// way too resource intensive on mobile connections with many reconnects.
 	// Actually we would need to request our own avatar, calculate the hash of it and publish
@@ -60,21 +104,70 @@ VCardManager::VCardManager(ClientWorker *clientWorker, QXmppClient *client, Avat
 
 void VCardManager::requestVCard(const QString &jid)
 {
-	if (m_client->state() == QXmppClient::ConnectedState)
-		m_client->findExtension<QXmppVCardManager>()->requestVCard(jid);
-	else
-		qWarning() << "[VCardManager] Could not fetch VCard: Not connected to a server";
+	if (m_storedPhotoHashes.contains(jid)) {
+		emit VCardDb::instance()->fetchVCardRequested(jid);
+
+		// The stored vCard is refreshed once per session since other fields than the
+		// photo (e.g. the name) can change without being announced.
+		if (!m_refreshedJids.contains(jid))
+			enqueueVCardRequest(jid, LowPriority);
+	} else {
+		enqueueVCardRequest(jid, HighPriority);
+	}
+}
+
+void VCardManager::requestMissingVCards(const QStringList &jids)
+{
+	// The JIDs are checked as soon as it is known which vCards are stored.
+	if (!m_isStoredPhotoHashesLoaded) {
+		m_jidsToBeCheckedForMissingVCards << jids;
+		return;
+	}
+
+	for (const auto &jid : jids) {
+		if (!m_storedPhotoHashes.contains(jid))
+			enqueueVCardRequest(jid);
+	}
+}
+
+void VCardManager::enqueueVCardRequest(const QString &jid, Priority priority)
+{
+	if (m_runningRequests.contains(jid))
+		return;
+
+	if (m_queuedJids.contains(jid)) {
+		if (priority == HighPriority)
+			prioritize(jid);
+		return;
+	}
+
+	m_queuedJids.insert(jid);
+	m_queues[priority].append(jid);
+
+	startRequests();
 }
 
 void VCardManager::handleVCardReceived(const QXmppVCardIq &iq)
 {
-	if (!iq.photo().isEmpty()) {
-		m_avatarStorage->addAvatar(QXmppUtils::jidToBareJid(iq.from().isEmpty() ? m_client->configuration().jid() : iq.from()), iq.photo());
+	const auto jid = QXmppUtils::jidToBareJid(iq.from().isEmpty() ? m_client->configuration().jid() : iq.from());
+
+	if (iq.type() == QXmppIq::Error) {
+		handleVCardUnavailable(jid);
+		return;
 	}
 
+	QString photoHash;
+	if (!iq.photo().isEmpty())
+		photoHash = m_avatarStorage->addAvatar(jid, iq.photo()).hash;
+
+	m_storedPhotoHashes.insert(jid, photoHash);
+	m_refreshedJids.insert(jid);
+	emit VCardDb::instance()->addVCardRequested(jid, photoHash, iq);
+
+	finishRequest(jid);
+
 	emit vCardReceived(iq);
 }
-
 void VCardManager::requestClientVCard()
 {
 	m_manager->requestClientVCard();
@@ -90,17 +183,26 @@ void VCardManager::handleClientVCardReceived()
 
 void VCardManager::handlePresenceReceived(const QXmppPresence &presence)
 {
+	const auto jid = QXmppUtils::jidToBareJid(presence.from());
+
 	if (presence.vCardUpdateType() == QXmppPresence::VCardUpdateValidPhoto) {
-		QString hash = m_avatarStorage->getHashOfJid(QXmppUtils::jidToBareJid(presence.from()));
-		QString newHash = presence.photoHash().toHex();
+		// The avatar's hash is used for vCards stored before the vCards were stored in
+		// the database.
+		const auto hash = m_storedPhotoHashes.value(jid, m_avatarStorage->getHashOfJid(jid));
+		const QString newHash = presence.photoHash().toHex();
 
 		// check if hash differs and we need to refetch the avatar
 		if (hash != newHash)
-			m_manager->requestVCard(QXmppUtils::jidToBareJid(presence.from()));
+			enqueueVCardRequest(jid);
 
 	} else if (presence.vCardUpdateType() == QXmppPresence::VCardUpdateNoPhoto) {
-		QString bareJid = QXmppUtils::jidToBareJid(presence.from());
+		QString bareJid = jid;
 		m_avatarStorage->clearAvatar(bareJid);
+
+		if (const auto itr = m_storedPhotoHashes.find(jid); itr != m_storedPhotoHashes.end() && !itr->isEmpty()) {
+			itr->clear();
+			emit VCardDb::instance()->updatePhotoHashRequested(jid, {});
+		}
 	}
 	// ignore VCardUpdateNone (protocol unsupported) and VCardUpdateNotReady
 }
@@ -123,3 +225,113 @@ void VCardManager::changeNicknameAfterReceivingCurrentVCard()
 	m_nicknameToBeSetAfterReceivingCurrentVCard.clear();
 	m_clientWorker->finishTask();
 }
+
+void VCardManager::handlePhotoHashesFetched(const QHash<QString, QString> &photoHashes)
+{
+	// vCards received in the meantime are newer than the stored ones.
+	for (auto itr = photoHashes.cbegin(); itr != photoHashes.cend(); ++itr) {
+		if (!m_storedPhotoHashes.contains(itr.key()))
+			m_storedPhotoHashes.insert(itr.key(), itr.value());
+	}
+
+	m_isStoredPhotoHashesLoaded = true;
+
+	requestMissingVCards(m_jidsToBeCheckedForMissingVCards);
+	m_jidsToBeCheckedForMissingVCards.clear();
+}
+
+void VCardManager::handleStoredVCardFetched(const QString &jid, const QXmppVCardIq &vCard)
+{
+	if (jid == AccountManager::instance()->jid())
+		m_clientWorker->caches()->vCardCache->setVCard(jid, vCard);
+
+	emit vCardReceived(vCard);
+}
+
+void VCardManager::prioritize(const QString &jid)
+{
+	if (!m_queuedJids.contains(jid))
+		return;
+
+	m_queues[LowPriority].removeOne(jid);
+	m_queues[HighPriority].removeOne(jid);
+	m_queues[HighPriority].prepend(jid);
+}
+
+void VCardManager::startRequests()
+{
+	if (m_client->state() != QXmppClient::ConnectedState)
+		return;
+
+	while (m_runningRequests.size() < VCARD_MAX_RUNNING_REQUESTS) {
+		auto &queue = m_queues[HighPriority].isEmpty() ? m_queues[LowPriority] : m_queues[HighPriority];
+		if (queue.isEmpty())
+			break;
+
+		const auto jid = queue.takeFirst();
+		m_queuedJids.remove(jid);
+
+		m_requestWatcher->watch(m_manager->requestVCard(jid), jid);
+
+		QElapsedTimer timer;
+		timer.start();
+		m_runningRequests.insert(jid, timer);
+	}
+
+	if (!m_runningRequests.isEmpty() && !m_timeoutTimer->isActive())
+		m_timeoutTimer->start();
+}
+
+void VCardManager::finishRequest(const QString &jid)
+{
+	if (!m_runningRequests.remove(jid))
+		return;
+
+	startRequests();
+
+	if (m_runningRequests.isEmpty())
+		m_timeoutTimer->stop();
+}
+
+void VCardManager::handleVCardUnavailable(const QString &jid)
+{
+	// An empty vCard is stored so that the vCard is only requested again when the
+	// contact's presence announces a photo. A stored vCard is kept.
+	if (!m_storedPhotoHashes.contains(jid)) {
+		QXmppVCardIq vCard;
+		vCard.setType(QXmppIq::Result);
+
+		m_storedPhotoHashes.insert(jid, {});
+		emit VCardDb::instance()->addVCardRequested(jid, {}, vCard);
+	}
+
+	m_refreshedJids.insert(jid);
+	finishRequest(jid);
+}
+
+void VCardManager::handleTimeouts()
+{
+	QStringList timedOutJids;
+	for (auto itr = m_runningRequests.cbegin(); itr != m_runningRequests.cend(); ++itr) {
+		if (itr->hasExpired(std::chrono::milliseconds(VCARD_REQUEST_TIMEOUT).count()))
+			timedOutJids << itr.key();
+	}
+
+	for (const auto &jid : std::as_const(timedOutJids)) {
+		qDebug() << "[client] [VCardManager] Request of the vCard of" << jid << "timed out";
+		handleVCardUnavailable(jid);
+	}
+}
+
+void VCardManager::handleDisconnected()
+{
+	// The running requests are started again after reconnecting.
+	for (auto itr = m_runningRequests.cbegin(); itr != m_runningRequests.cend(); ++itr) {
+		m_queuedJids.insert(itr.key());
+		m_queues[LowPriority].prepend(itr.key());
+	}
+
+	m_runningRequests.clear();
+	m_requestWatcher->clear();
+	m_timeoutTimer->stop();
+}
@@ -30,7 +30,13 @@
 
 #pragma once
 
+// Qt
+#include <QElapsedTimer>
+#include <QHash>
+#include <QList>
 #include <QObject>
+#include <QSet>
+#include <QStringList>
 
 class AvatarFileStorage;
 class ClientWorker;
@@ -38,7 +44,19 @@ class QXmppClient;
 class QXmppPresence;
 class QXmppVCardIq;
 class QXmppVCardManager;
+class QTimer;
+class VCardRequestWatcher;
 
+/**
+ * @class VCardManager Manager for vCards (XEP-0054) and vCard-based avatars (XEP-0153)
+ *
+ * Received vCards are stored in the database. A contact's vCard is only fetched again if
+ * its presence announces a photo that differs from the stored one or once per session if
+ * it is shown to the user. If a contact has no vCard or its request fails, an empty vCard
+ * is stored so that it is not requested again. Requests are
+ * deduplicated and only a limited number of them is running at once while the remaining
+ * ones are queued by their priorities.
+ */
 class VCardManager : public QObject
 {
 	Q_OBJECT
@@ -46,13 +64,39 @@ class VCardManager : public QObject
 public:
 	VCardManager(ClientWorker *clientWorker, QXmppClient *client, AvatarFileStorage *avatars, QObject *parent = nullptr);
 
+	enum Priority : quint8 {
+		LowPriority,
+		HighPriority,
+	};
+
 	/**
-	 * Requests the vCard of a given JID from the JID's server.
+	 * Provides the vCard of a given JID that is currently visible to the user (e.g. in
+	 * the contact details).
+	 *
+	 * The stored vCard is used if available and refreshed with a low priority. Otherwise,
+	 * it is requested from the JID's server with a high priority.
 	 *
 	 * @param jid JID for which the vCard is being requested
 	 */
 	void requestVCard(const QString &jid);
 
+	/**
+	 * Requests the vCards of the given JIDs from their servers if they are not stored yet.
+	 *
+	 * @param jids bare JIDs for which the vCards are being requested
+	 */
+	void requestMissingVCards(const QStringList &jids);
+
+	/**
+	 * Enqueues the request of a vCard from the JID's server.
+	 *
+	 * A request for the same JID that is already enqueued or running is not duplicated.
+	 *
+	 * @param jid bare JID for which the vCard is being requested
+	 * @param priority priority of the request
+	 */
+	void enqueueVCardRequest(const QString &jid, Priority priority = LowPriority);
+
 	/**
 	 * Handles an incoming vCard and processes it like saving a containing user avatar etc..
 	 *
@@ -112,9 +156,52 @@ private:
 	 */
 	void changeNicknameAfterReceivingCurrentVCard();
 
+	void handlePhotoHashesFetched(const QHash<QString, QString> &photoHashes);
+	void handleStoredVCardFetched(const QString &jid, const QXmppVCardIq &vCard);
+
+	/**
+	 * Moves an enqueued request to the front of the queue.
+	 *
+	 * @param jid bare JID of the requested vCard
+	 */
+	void prioritize(const QString &jid);
+
+	/**
+	 * Starts as many enqueued requests as allowed.
+	 */
+	void startRequests();
+
+	/**
+	 * Marks the request of a vCard as finished and starts the next enqueued one.
+	 */
+	void finishRequest(const QString &jid);
+
+	/**
+	 * Handles a vCard request answered without a vCard or not answered in time.
+	 *
+	 * @param jid bare JID whose vCard was requested
+	 */
+	void handleVCardUnavailable(const QString &jid);
+
+	void handleTimeouts();
+	void handleDisconnected();
+
 	ClientWorker *m_clientWorker;
 	QXmppClient *m_client;
 	QXmppVCardManager *m_manager;
+	VCardRequestWatcher *m_requestWatcher;
 	AvatarFileStorage *m_avatarStorage;
 	QString m_nicknameToBeSetAfterReceivingCurrentVCard;
+
+	// hex-encoded SHA-1 hashes of the photos of the stored vCards mapped to their JIDs
+	QHash<QString, QString> m_storedPhotoHashes;
+	bool m_isStoredPhotoHashesLoaded = false;
+	// bare JIDs whose vCards were received since the start
+	QSet<QString> m_refreshedJids;
+	QStringList m_jidsToBeCheckedForMissingVCards;
+
+	QList<QString> m_queues[HighPriority + 1];
+	QSet<QString> m_queuedJids;
+	QHash<QString, QElapsedTimer> m_runningRequests;
+	QTimer *m_timeoutTimer;
 };
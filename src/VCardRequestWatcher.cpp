@@ -0,0 +1,72 @@
+/*
+ *  Kaidan - A user-friendly XMPP client for every device!
+ *
+ *  Copyright (C) 2016-2021 Kaidan developers and contributors
+ *  (see the LICENSE file for a full list of copyright authors)
+ *
+ *  Kaidan is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  In addition, as a special exception, the author of Kaidan gives
+ *  permission to link the code of its release with the OpenSSL
+ *  project's "OpenSSL" library (or with modified versions of it that
+ *  use the same license as the "OpenSSL" library), and distribute the
+ *  linked executables. You must obey the GNU General Public License in
+ *  all respects for all of the code used other than "OpenSSL". If you
+ *  modify this file, you may extend this exception to your version of
+ *  the file, but you are not obligated to do so.  If you do not wish to
+ *  do so, delete this exception statement from your version.
+ *
+ *  Kaidan is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Kaidan.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "VCardRequestWatcher.h"
+
+// Qt
+#include <QDomElement>
+// QXmpp
+#include <QXmppVCardIq.h>
+
+VCardRequestWatcher::VCardRequestWatcher() = default;
+
+void VCardRequestWatcher::watch(const QString &requestId, const QString &jid)
+{
+	m_requests.insert(requestId, jid);
+}
+
+void VCardRequestWatcher::clear()
+{
+	m_requests.clear();
+}
+
+bool VCardRequestWatcher::handleStanza(const QDomElement &element)
+{
+	if (element.tagName() != QStringLiteral("iq"))
+		return false;
+
+	const auto itr = m_requests.find(element.attribute(QStringLiteral("id")));
+	if (itr == m_requests.end())
+		return false;
+
+	const auto type = element.attribute(QStringLiteral("type"));
+	if (type != QStringLiteral("result") && type != QStringLiteral("error"))
+		return false;
+
+	const auto jid = itr.value();
+	m_requests.erase(itr);
+
+	// Responses containing a vCard are handled by QXmppVCardManager.
+	if (QXmppVCardIq::isVCard(element))
+		return false;
+
+	emit requestFailed(jid);
+	return true;
+}
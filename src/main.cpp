@@ -28,16 +28,22 @@
  *  along with Kaidan.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+// std
+#include <memory>
+
 // Qt
 #include <QCommandLineOption>
 #include <QCommandLineParser>
 #include <QDebug>
 #include <QDir>
+#include <QElapsedTimer>
 #include <QIcon>
 #include <QLibraryInfo>
 #include <QLocale>
 #include <QQmlApplicationEngine>
+#include <QQuickWindow>
 #include <QTranslator>
+#include <QtConcurrent/QtConcurrent>
 #include <qqml.h>
 
 // QXmpp
@@ -46,12 +52,14 @@
 #include <QXmppVCardIq.h>
 #include <QXmppRegisterIq.h>
 #include <QXmppResultSet.h>
+#include <QXmppRosterIq.h>
 #include <QXmppVersionIq.h>
 
 // Kaidan
 #include "AccountManager.h"
 #include "AudioDeviceModel.h"
 #include "AvatarFileStorage.h"
+#include "AvatarImageProvider.h"
 #include "BitsOfBinaryImageProvider.h"
 #include "CameraModel.h"
 #include "CredentialsGenerator.h"
@@ -62,6 +70,7 @@
 #include "Enums.h"
 #include "GuiStyle.h"
 #include "Kaidan.h"
+#include "LoggingCategories.h"
 #include "MediaUtils.h"
 #include "MediaRecorder.h"
 #include "Message.h"
@@ -69,6 +78,7 @@
 #include "MessageHandler.h"
 #include "QmlUtils.h"
 #include "QrCodeGenerator.h"
+#include "QrCodeImageProvider.h"
 #include "QrCodeScannerFilter.h"
 #include "RegistrationDataFormFilterModel.h"
 #include "RegistrationManager.h"
@@ -96,6 +106,7 @@ Q_DECLARE_METATYPE(QXmppDiscoveryIq);
 Q_DECLARE_METATYPE(QXmppPresence)
 Q_DECLARE_METATYPE(QXmppStanza::Error)
 Q_DECLARE_METATYPE(QXmppResultSetReply);
+Q_DECLARE_METATYPE(QXmppRosterIq)
 Q_DECLARE_METATYPE(QXmppVCardIq)
 Q_DECLARE_METATYPE(QXmppVersionIq)
 
@@ -168,6 +179,9 @@ CommandLineParseResult parseCommandLine(QCommandLineParser &parser, QString *err
 
 Q_DECL_EXPORT int main(int argc, char *argv[])
 {
+	QElapsedTimer startupTimer;
+	startupTimer.start();
+
 #ifdef Q_OS_WIN
 	if (AttachConsole(ATTACH_PARENT_PROCESS)) {
 		freopen("CONOUT$", "w", stdout);
@@ -250,11 +264,16 @@ Q_DECL_EXPORT int main(int argc, char *argv[])
 	qRegisterMetaType<TransferJob*>();
 	qRegisterMetaType<QmlUtils*>();
 	qRegisterMetaType<QVector<Message>>();
+	qRegisterMetaType<QVector<AddedMessage>>();
 	qRegisterMetaType<QVector<RosterItem>>();
 	qRegisterMetaType<QHash<QString,RosterItem>>();
+	qRegisterMetaType<QHash<QString,QString>>();
 	qRegisterMetaType<std::function<void(RosterItem&)>>();
 	qRegisterMetaType<std::function<void(Message&)>>();
+	qRegisterMetaType<DeliveryStateUpdates>();
+	qRegisterMetaType<ChatStates>();
 	qRegisterMetaType<QXmppVCardIq>();
+	qRegisterMetaType<QXmppRosterIq>();
 	qRegisterMetaType<QMimeType>();
 	qRegisterMetaType<CameraInfo>();
 	qRegisterMetaType<AudioDeviceInfo>();
@@ -292,6 +311,7 @@ Q_DECL_EXPORT int main(int argc, char *argv[])
 	qRegisterMetaType<QXmppResultSetReply>();
 	qRegisterMetaType<QXmppMessage>();
 	qRegisterMetaType<QXmppDiscoveryIq>();
+	qRegisterMetaType<QVector<QXmppDiscoveryIq>>();
 
 	// Qt-Translator
 	QTranslator qtTranslator;
@@ -367,6 +387,8 @@ Q_DECL_EXPORT int main(int argc, char *argv[])
 	QQmlApplicationEngine engine;
 
 	engine.addImageProvider(QLatin1String(BITS_OF_BINARY_IMAGE_PROVIDER_NAME), BitsOfBinaryImageProvider::instance());
+	engine.addImageProvider(QLatin1String(AVATAR_IMAGE_PROVIDER_NAME), new AvatarImageProvider(kaidan.avatarStorage()));
+	engine.addImageProvider(QLatin1String(QR_CODE_IMAGE_PROVIDER_NAME), new QrCodeImageProvider);
 
 	// QtQuickControls2 Style
 	if (qEnvironmentVariableIsEmpty("QT_QUICK_CONTROLS_STYLE")) {
@@ -463,6 +485,19 @@ Q_DECL_EXPORT int main(int argc, char *argv[])
 	if (engine.rootObjects().isEmpty())
 		return -1;
 
+	qCDebug(KAIDAN_STARTUP_LOG) << "Loaded QML after" << startupTimer.elapsed() << "ms";
+
+	// Load the MIME types in the background after the first frame so that they are
+	// ready when needed without delaying the startup.
+	if (auto *window = qobject_cast<QQuickWindow *>(engine.rootObjects().first())) {
+		auto connection = std::make_shared<QMetaObject::Connection>();
+		*connection = QObject::connect(window, &QQuickWindow::frameSwapped, window, [connection, startupTimer]() {
+			QObject::disconnect(*connection);
+			qCDebug(KAIDAN_STARTUP_LOG) << "Rendered first frame after" << startupTimer.elapsed() << "ms";
+			QtConcurrent::run(&MediaUtils::preloadMimeTypes);
+		});
+	}
+
 #ifdef Q_OS_ANDROID
 	QtAndroid::hideSplashScreen();
 #endif
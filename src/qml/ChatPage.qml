@@ -348,6 +348,7 @@ ChatPageBase {
 			contextMenu: messageContextMenu
 			isOwn: model.isOwn
 			messageBody: model.body
+			formattedBody: model.formattedBody
 			dateTime: new Date(model.timestamp)
 			deliveryState: model.deliveryState
 			mediaType: model.mediaType
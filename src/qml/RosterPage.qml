@@ -94,7 +94,7 @@ Kirigami.ScrollablePage {
 			height: Kirigami.Units.gridUnit * 2
 			visible: searchAction.checked
 			onVisibleChanged: text = ""
-			onTextChanged: filterModel.setFilterFixedString(text.toLowerCase())
+			onTextChanged: filterModel.searchText = text
 		}
 	}
 
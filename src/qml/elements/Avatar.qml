@@ -29,19 +29,40 @@
  */
 
 import QtQuick 2.14
+import QtQuick.Window 2.14
 import org.kde.kirigami 2.12 as Kirigami
 
 import im.kaidan.kaidan 1.0
 
 Item {
+	id: root
+
 	property string jid
 	property string name
 	property double radius: width * 0.5
 
+	// Small avatars are loaded pre-scaled via the avatar image provider.
+	readonly property int pixelSize: Math.ceil(Math.max(width, height) * Screen.devicePixelRatio)
+	readonly property string avatarUrl: jid ? Kaidan.avatarStorage.getAvatarUrl(jid, pixelSize) : ""
+	readonly property bool isAvatarScaled: avatarUrl.startsWith("image://")
+
+	RoundedStaticImage {
+		id: scaledImageAvatar
+		visible: source != ""
+		source: root.isAvatarScaled ? root.avatarUrl : ""
+		sourceSize.width: root.pixelSize
+		sourceSize.height: root.pixelSize
+		fillMode: Image.PreserveAspectFit
+		asynchronous: true
+		height: width
+		radius: parent.radius
+		anchors.fill: parent
+	}
+
 	RoundedImage {
 		id: imageAvatar
 		visible: source != ""
-		source: parent.jid ? Kaidan.avatarStorage.getAvatarUrl(parent.jid) : ""
+		source: root.isAvatarScaled ? "" : root.avatarUrl
 		fillMode: Image.PreserveAspectFit
 		mipmap: true
 		height: width
@@ -50,7 +71,7 @@ Item {
 	}
 
 	TextAvatar {
-		visible: !imageAvatar.visible
+		visible: !imageAvatar.visible && !scaledImageAvatar.visible
 		jid: parent.jid
 		name: parent.name
 		radius: parent.radius
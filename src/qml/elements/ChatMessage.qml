@@ -48,6 +48,7 @@ RowLayout {
 	property string senderName
 	property bool isOwn: true
 	property string messageBody
+	property string formattedBody
 	property date dateTime
 	property int deliveryState: Enums.DeliveryState.Delivered
 	property int mediaType
@@ -226,7 +227,7 @@ RowLayout {
 				Controls.Label {
 					id: bodyLabel
 					visible: messageBody
-					text: Utils.formatMessage(messageBody)
+					text: formattedBody
 					textFormat: Text.StyledText
 					wrapMode: Text.Wrap
 					color: Kirigami.Theme.textColor
@@ -28,8 +28,7 @@
  *  along with Kaidan.  If not, see <http://www.gnu.org/licenses/>.
  */
 
-import QtQuick.Layouts 1.14
-import org.kde.kirigami 2.12 as Kirigami
+import QtQuick 2.14
 
 import im.kaidan.kaidan 1.0
 
@@ -39,14 +38,25 @@ import im.kaidan.kaidan 1.0
  * If a JID is provided, a QR code with a general XMPP URI for sharing with contacts is generated.
  * Otherwise a QR code with a login XMPP URI for logging in on another device is generated.
  */
-Kirigami.Icon {
+Image {
 	id: qrCode
 
+	readonly property int edgePixelCount: Math.min(width, height)
+
+	// The QR code is generated in the background for the current size.
+	// QR codes for logging in are not cached because they may contain the password.
+	// Their text is only kept by the QR code generator of this item until the text
+	// changes or this item is destroyed.
 	source: {
-		if (width > 0)
-			return jid ? qrCodeGenerator.generateBareJidQrCode(width, jid) : qrCodeGenerator.generateLoginUriQrCode(width)
+		if (edgePixelCount > 0)
+			return jid ? qrCodeGenerator.qrCodeUrl(qrCodeGenerator.bareJidUri(jid)) : qrCodeGenerator.qrCodeUrl(qrCodeGenerator.loginUri(), false)
 		return ""
 	}
+	sourceSize: Qt.size(edgePixelCount, edgePixelCount)
+	fillMode: Image.PreserveAspectFit
+	asynchronous: true
+	cache: !!jid
+	smooth: false
 
 	property string jid
 
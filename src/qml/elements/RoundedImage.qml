@@ -29,24 +29,14 @@
  */
 
 import QtQuick 2.14
-import QtGraphicalEffects 1.14
 
 AnimatedImage {
 	id: img
 	property int radius: roundedCornersRadius
 
 	layer.enabled: true
-	layer.effect: OpacityMask {
-		maskSource: Item {
-			width: img.paintedWidth
-			height: img.paintedHeight
-
-			Rectangle {
-				anchors.centerIn: parent
-				width: Math.min(img.width, img.height)
-				height: width
-				radius: img.radius
-			}
-		}
+	layer.effect: RoundedImageMask {
+		image: img
+		radius: img.radius
 	}
 }
@@ -36,6 +36,7 @@
 #include <QNetworkAccessManager>
 #include <QNetworkReply>
 #include <QNetworkRequest>
+#include <QXmppClient.h>
 
 QXmppHttpUpload::QXmppHttpUpload(QXmppUploadManager *manager)
     : QXmppLoggable(manager),
@@ -293,7 +294,7 @@ void QXmppUploadManager::startNextUpload()
 
     const auto fileName = upload->customFileName().isEmpty() ? upload->fileInfo().fileName()
                                                              : upload->customFileName();
-    QString reqId = requestUploadSlot(upload->fileInfo(), fileName, {});
+    QString reqId = requestUploadSlot(upload->fileInfo(), fileName, m_uploadService);
     upload->setRequestId(reqId);
 
     if (reqId.isEmpty()) {
@@ -384,3 +385,44 @@ void QXmppUploadManager::setHttpAllowed(bool httpAllowed)
 {
     m_httpAllowed = httpAllowed;
 }
+
+/// Returns the JID of the upload service found by handleDiscoInfo() or an empty string if
+/// none was found.
+
+QString QXmppUploadManager::uploadService() const
+{
+    return m_uploadService;
+}
+
+/// Handles service discovery info and uses the entity as the upload service if it is one.
+///
+/// In contrast to the services found by QXmppUploadRequestManager, this can also be used
+/// for stored service discovery info instead of only for received one.
+
+void QXmppUploadManager::handleDiscoInfo(const QXmppDiscoveryIq &info)
+{
+    if (!m_uploadService.isEmpty() || !info.features().contains(QStringLiteral("urn:xmpp:http:upload:0")))
+        return;
+
+    const auto identities = info.identities();
+    for (const auto &identity : identities) {
+        if (identity.category() == QStringLiteral("store") && identity.type() == QStringLiteral("file")) {
+            m_uploadService = info.from();
+            emit uploadServiceChanged();
+            return;
+        }
+    }
+}
+
+void QXmppUploadManager::setClient(QXmppClient *client)
+{
+    QXmppUploadRequestManager::setClient(client);
+
+    // The upload service is discovered again after reconnecting.
+    connect(client, &QXmppClient::disconnected, this, [this]() {
+        if (!m_uploadService.isEmpty()) {
+            m_uploadService.clear();
+            emit uploadServiceChanged();
+        }
+    });
+}
@@ -35,6 +35,7 @@
 #include <QFileInfo>
 #include <QMutex>
 #include <QNetworkReply>
+#include <QXmppDiscoveryIq.h>
 #include <QXmppHttpUploadIq.h>
 #include <QXmppUploadRequestManager.h>
 
@@ -128,6 +129,9 @@ public:
     bool httpAllowed();
     void setHttpAllowed(bool httpAllowed);
 
+    QString uploadService() const;
+    void handleDiscoInfo(const QXmppDiscoveryIq &info);
+
 public slots:
     const QXmppHttpUpload* uploadFile(const QFileInfo &file, bool allowParallel = false,
                                       QString customFileName = QString());
@@ -135,6 +139,10 @@ public slots:
 signals:
     void uploadSucceeded(const QXmppHttpUpload *upload);
     void uploadFailed(const QXmppHttpUpload *upload);
+    void uploadServiceChanged();
+
+protected:
+    void setClient(QXmppClient *client) override;
 
 private slots:
     void startNextUpload();
@@ -147,6 +155,7 @@ private slots:
 
 private:
     bool m_httpAllowed = false;
+    QString m_uploadService;
 
     QList<QXmppHttpUpload*> m_uploads;
     int m_runningJobs = 0;
@@ -0,0 +1,151 @@
+// SPDX-FileCopyrightText: 2021 Kaidan developers and contributors
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <QtTest>
+
+#include <QXmppPresence.h>
+
+#include "../src/ChatStateCoalescer.h"
+#include "../src/PresenceCache.h"
+
+class ChatStateCoalescerTest : public QObject
+{
+	Q_OBJECT
+
+private:
+	Q_SLOT void initTestCase();
+	Q_SLOT void init();
+	Q_SLOT void testCoalescingInterval();
+	Q_SLOT void testBatch();
+	Q_SLOT void testUnchangedState();
+	Q_SLOT void testOfflineChatPartner();
+
+	void setAvailable(const QString &jid, bool isAvailable);
+
+	PresenceCache presenceCache;
+};
+
+void ChatStateCoalescerTest::initTestCase()
+{
+	qRegisterMetaType<ChatStates>();
+}
+
+void ChatStateCoalescerTest::init()
+{
+	presenceCache.clear();
+	setAvailable(QStringLiteral("alice@example.org/phone"), true);
+	setAvailable(QStringLiteral("carol@example.org/laptop"), true);
+}
+
+void ChatStateCoalescerTest::testCoalescingInterval()
+{
+	ChatStateCoalescer coalescer;
+	QSignalSpy spy(&coalescer, &ChatStateCoalescer::sendChatStatesRequested);
+
+	coalescer.setChatState(QStringLiteral("alice@example.org"), QXmppMessage::Composing);
+	coalescer.setChatState(QStringLiteral("alice@example.org"), QXmppMessage::Paused);
+	coalescer.setChatState(QStringLiteral("alice@example.org"), QXmppMessage::Active);
+
+	// Only the latest state is sent after the coalescing interval.
+	QVERIFY(spy.isEmpty());
+	QVERIFY(spy.wait());
+	QCOMPARE(spy.count(), 1);
+
+	const auto states = spy.first().first().value<ChatStates>();
+	QCOMPARE(states, ChatStates({ { QStringLiteral("alice@example.org"), QXmppMessage::Active } }));
+	QCOMPARE(coalescer.sentStates(), 1u);
+	QCOMPARE(coalescer.coalescedStates(), 2u);
+
+	// Nothing is sent without new states.
+	QVERIFY(!spy.wait(600));
+}
+
+void ChatStateCoalescerTest::testBatch()
+{
+	ChatStateCoalescer coalescer;
+	QSignalSpy spy(&coalescer, &ChatStateCoalescer::sendChatStatesRequested);
+
+	// States for multiple chat partners are sent together.
+	coalescer.setChatState(QStringLiteral("alice@example.org"), QXmppMessage::Active);
+	coalescer.setChatState(QStringLiteral("carol@example.org"), QXmppMessage::Composing);
+	coalescer.flush();
+
+	QCOMPARE(spy.count(), 1);
+	QCOMPARE(spy.first().first().value<ChatStates>(), ChatStates({
+		{ QStringLiteral("alice@example.org"), QXmppMessage::Active },
+		{ QStringLiteral("carol@example.org"), QXmppMessage::Composing },
+	}));
+	QCOMPARE(coalescer.sentStates(), 2u);
+
+	// States for empty JIDs are ignored.
+	coalescer.setChatState({}, QXmppMessage::Active);
+	coalescer.flush();
+	QCOMPARE(spy.count(), 1);
+}
+
+void ChatStateCoalescerTest::testUnchangedState()
+{
+	ChatStateCoalescer coalescer;
+	QSignalSpy spy(&coalescer, &ChatStateCoalescer::sendChatStatesRequested);
+
+	// A chat partner who has not received any state treats the user as gone.
+	coalescer.setChatState(QStringLiteral("alice@example.org"), QXmppMessage::Gone);
+	coalescer.setChatState(QStringLiteral("carol@example.org"), QXmppMessage::None);
+	coalescer.flush();
+	QVERIFY(spy.isEmpty());
+	QCOMPARE(coalescer.coalescedStates(), 2u);
+
+	coalescer.setChatState(QStringLiteral("alice@example.org"), QXmppMessage::Active);
+	coalescer.flush();
+	QCOMPARE(spy.count(), 1);
+
+	// The state last sent is not sent again.
+	coalescer.setChatState(QStringLiteral("alice@example.org"), QXmppMessage::Active);
+	coalescer.flush();
+	QCOMPARE(spy.count(), 1);
+	QCOMPARE(coalescer.coalescedStates(), 3u);
+
+	coalescer.setChatState(QStringLiteral("alice@example.org"), QXmppMessage::Inactive);
+	coalescer.flush();
+	QCOMPARE(spy.count(), 2);
+}
+
+void ChatStateCoalescerTest::testOfflineChatPartner()
+{
+	ChatStateCoalescer coalescer;
+	QSignalSpy spy(&coalescer, &ChatStateCoalescer::sendChatStatesRequested);
+
+	// States are not sent to chat partners being offline.
+	coalescer.setChatState(QStringLiteral("bob@example.org"), QXmppMessage::Composing);
+	coalescer.flush();
+	QVERIFY(spy.isEmpty());
+	QCOMPARE(coalescer.suppressedStates(), 1u);
+
+	coalescer.setChatState(QStringLiteral("alice@example.org"), QXmppMessage::Active);
+	coalescer.flush();
+	QCOMPARE(spy.count(), 1);
+
+	// The state seen by a chat partner is reset when it goes offline.
+	setAvailable(QStringLiteral("alice@example.org/phone"), false);
+	coalescer.setChatState(QStringLiteral("alice@example.org"), QXmppMessage::Active);
+	coalescer.flush();
+	QCOMPARE(spy.count(), 1);
+	QCOMPARE(coalescer.suppressedStates(), 2u);
+
+	setAvailable(QStringLiteral("alice@example.org/phone"), true);
+	coalescer.setChatState(QStringLiteral("alice@example.org"), QXmppMessage::Active);
+	coalescer.flush();
+	QCOMPARE(spy.count(), 2);
+	QCOMPARE(spy.last().first().value<ChatStates>(), ChatStates({ { QStringLiteral("alice@example.org"), QXmppMessage::Active } }));
+}
+
+void ChatStateCoalescerTest::setAvailable(const QString &jid, bool isAvailable)
+{
+	QXmppPresence presence(isAvailable ? QXmppPresence::Available : QXmppPresence::Unavailable);
+	presence.setFrom(jid);
+	presenceCache.updatePresence(presence);
+}
+
+QTEST_GUILESS_MAIN(ChatStateCoalescerTest)
+#include "ChatStateCoalescerTest.moc"
@@ -0,0 +1,118 @@
+// SPDX-FileCopyrightText: 2021 Kaidan developers and contributors
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <QtTest>
+
+#include "../src/DeliveryStateAggregator.h"
+
+class DeliveryStateAggregatorTest : public QObject
+{
+	Q_OBJECT
+
+private:
+	Q_SLOT void initTestCase();
+	Q_SLOT void testAggregationInterval();
+	Q_SLOT void testReplacement();
+	Q_SLOT void testMaxCount();
+	Q_SLOT void testFlush();
+};
+
+void DeliveryStateAggregatorTest::initTestCase()
+{
+	qRegisterMetaType<DeliveryStateUpdates>();
+}
+
+void DeliveryStateAggregatorTest::testAggregationInterval()
+{
+	DeliveryStateAggregator aggregator;
+	QSignalSpy spy(&aggregator, &DeliveryStateAggregator::deliveryStatesChanged);
+
+	aggregator.setDeliveryState(QStringLiteral("1"), Enums::DeliveryState::Sent);
+	aggregator.setDeliveryState(QStringLiteral("2"), Enums::DeliveryState::Delivered);
+	aggregator.setDeliveryState(QStringLiteral("3"), Enums::DeliveryState::Error, QStringLiteral("error"));
+
+	// The changes are applied together after the aggregation interval.
+	QVERIFY(spy.isEmpty());
+	QVERIFY(spy.wait());
+	QCOMPARE(spy.count(), 1);
+
+	const auto updates = spy.first().first().value<DeliveryStateUpdates>();
+	QCOMPARE(updates.size(), 3);
+	QCOMPARE(updates.value(QStringLiteral("1")).deliveryState, Enums::DeliveryState::Sent);
+	QCOMPARE(updates.value(QStringLiteral("2")).deliveryState, Enums::DeliveryState::Delivered);
+	QCOMPARE(updates.value(QStringLiteral("3")).deliveryState, Enums::DeliveryState::Error);
+	QCOMPARE(updates.value(QStringLiteral("3")).errorText, QStringLiteral("error"));
+
+	// Nothing is applied without new changes.
+	QVERIFY(!spy.wait(300));
+}
+
+void DeliveryStateAggregatorTest::testReplacement()
+{
+	DeliveryStateAggregator aggregator;
+	QSignalSpy spy(&aggregator, &DeliveryStateAggregator::deliveryStatesChanged);
+
+	// A delivery receipt received before the server's acknowledgement is kept.
+	aggregator.setDeliveryState(QStringLiteral("1"), Enums::DeliveryState::Delivered);
+	aggregator.setDeliveryState(QStringLiteral("1"), Enums::DeliveryState::Sent);
+
+	// Other changes replace the enqueued ones.
+	aggregator.setDeliveryState(QStringLiteral("2"), Enums::DeliveryState::Sent);
+	aggregator.setDeliveryState(QStringLiteral("2"), Enums::DeliveryState::Error, QStringLiteral("error"));
+	aggregator.setDeliveryState(QStringLiteral("3"), Enums::DeliveryState::Sent);
+	aggregator.setDeliveryState(QStringLiteral("3"), Enums::DeliveryState::Delivered);
+
+	aggregator.flush();
+	QCOMPARE(spy.count(), 1);
+
+	const auto updates = spy.first().first().value<DeliveryStateUpdates>();
+	QCOMPARE(updates.size(), 3);
+	QCOMPARE(updates.value(QStringLiteral("1")).deliveryState, Enums::DeliveryState::Delivered);
+	QCOMPARE(updates.value(QStringLiteral("2")).deliveryState, Enums::DeliveryState::Error);
+	QCOMPARE(updates.value(QStringLiteral("2")).errorText, QStringLiteral("error"));
+	QCOMPARE(updates.value(QStringLiteral("3")).deliveryState, Enums::DeliveryState::Delivered);
+}
+
+void DeliveryStateAggregatorTest::testMaxCount()
+{
+	DeliveryStateAggregator aggregator;
+	QSignalSpy spy(&aggregator, &DeliveryStateAggregator::deliveryStatesChanged);
+
+	for (int i = 0; i < 499; i++)
+		aggregator.setDeliveryState(QString::number(i), Enums::DeliveryState::Sent);
+	QVERIFY(spy.isEmpty());
+
+	// The changes are applied immediately once there are too many of them.
+	aggregator.setDeliveryState(QStringLiteral("499"), Enums::DeliveryState::Sent);
+	QCOMPARE(spy.count(), 1);
+	QCOMPARE(spy.first().first().value<DeliveryStateUpdates>().size(), 500);
+
+	// The aggregation starts again for the next change.
+	aggregator.setDeliveryState(QStringLiteral("500"), Enums::DeliveryState::Sent);
+	QCOMPARE(spy.count(), 1);
+	QVERIFY(spy.wait());
+	QCOMPARE(spy.count(), 2);
+	QCOMPARE(spy.last().first().value<DeliveryStateUpdates>().size(), 1);
+}
+
+void DeliveryStateAggregatorTest::testFlush()
+{
+	DeliveryStateAggregator aggregator;
+	QSignalSpy spy(&aggregator, &DeliveryStateAggregator::deliveryStatesChanged);
+
+	// Nothing is applied without any changes.
+	aggregator.flush();
+	QVERIFY(spy.isEmpty());
+
+	aggregator.setDeliveryState(QStringLiteral("1"), Enums::DeliveryState::Sent);
+	aggregator.flush();
+	QCOMPARE(spy.count(), 1);
+
+	// The timer is stopped by flushing.
+	QVERIFY(!spy.wait(300));
+	QCOMPARE(spy.count(), 1);
+}
+
+QTEST_GUILESS_MAIN(DeliveryStateAggregatorTest)
+#include "DeliveryStateAggregatorTest.moc"
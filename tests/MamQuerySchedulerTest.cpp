@@ -0,0 +1,215 @@
+// SPDX-FileCopyrightText: 2021 Kaidan developers and contributors
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <QtTest>
+
+#include "../src/MamQueryScheduler.h"
+
+class MamQuerySchedulerTest : public QObject
+{
+	Q_OBJECT
+
+private:
+	Q_SLOT void init();
+	Q_SLOT void testMaxRunningQueries();
+	Q_SLOT void testPriorities();
+	Q_SLOT void testPrioritize();
+	Q_SLOT void testProgress();
+	Q_SLOT void testRetry();
+	Q_SLOT void testGivingUp();
+	Q_SLOT void testClear();
+
+	QString startQuery(const QString &jid);
+
+	// JIDs of the started queries in the order they were started
+	QStringList startedJids;
+	// IDs of the started queries in the order they were started
+	QStringList startedQueryIds;
+};
+
+void MamQuerySchedulerTest::init()
+{
+	startedJids.clear();
+	startedQueryIds.clear();
+}
+
+void MamQuerySchedulerTest::testMaxRunningQueries()
+{
+	MamQueryScheduler scheduler([this](const QString &jid) { return startQuery(jid); });
+	scheduler.setMaxRunningQueries(2);
+
+	for (const auto &jid : { "a@example.org", "b@example.org", "c@example.org", "d@example.org" })
+		scheduler.enqueue(QString::fromLatin1(jid));
+
+	QCOMPARE(startedJids, QStringList({ "a@example.org", "b@example.org" }));
+	QCOMPARE(scheduler.queueDepth(), 2);
+	QVERIFY(scheduler.isQueryRunning(startedQueryIds.at(0)));
+	QVERIFY(!scheduler.isIdle());
+
+	// Finishing a query starts the next one.
+	QVERIFY(scheduler.finishQuery(startedQueryIds.at(0)));
+	QVERIFY(!scheduler.isQueryRunning(startedQueryIds.at(0)));
+	QCOMPARE(startedJids.size(), 3);
+	QCOMPARE(startedJids.last(), QStringLiteral("c@example.org"));
+
+	// Queries not started by the scheduler are not handled.
+	QVERIFY(!scheduler.finishQuery(QStringLiteral("unknown")));
+	QVERIFY(!scheduler.finishQuery(startedQueryIds.at(0)));
+	QCOMPARE(startedJids.size(), 3);
+
+	// Increasing the maximum starts queued queries immediately.
+	scheduler.setMaxRunningQueries(3);
+	QCOMPARE(startedJids.size(), 4);
+	QCOMPARE(scheduler.queueDepth(), 0);
+}
+
+void MamQuerySchedulerTest::testPriorities()
+{
+	MamQueryScheduler scheduler([this](const QString &jid) { return startQuery(jid); });
+	scheduler.setMaxRunningQueries(1);
+
+	scheduler.enqueue(QStringLiteral("running@example.org"));
+	scheduler.enqueue(QStringLiteral("low@example.org"), MamQueryScheduler::LowPriority);
+	scheduler.enqueue(QStringLiteral("normal1@example.org"), MamQueryScheduler::NormalPriority);
+	scheduler.enqueue(QStringLiteral("high@example.org"), MamQueryScheduler::HighPriority);
+	scheduler.enqueue(QStringLiteral("normal2@example.org"), MamQueryScheduler::NormalPriority);
+
+	while (!scheduler.isIdle())
+		QVERIFY(scheduler.finishQuery(startedQueryIds.last()));
+
+	QCOMPARE(startedJids, QStringList({
+		"running@example.org",
+		"high@example.org",
+		"normal1@example.org",
+		"normal2@example.org",
+		"low@example.org",
+	}));
+}
+
+void MamQuerySchedulerTest::testPrioritize()
+{
+	MamQueryScheduler scheduler([this](const QString &jid) { return startQuery(jid); });
+	scheduler.setMaxRunningQueries(1);
+
+	scheduler.enqueue(QStringLiteral("running@example.org"));
+	scheduler.enqueue(QStringLiteral("normal@example.org"));
+	scheduler.enqueue(QStringLiteral("low@example.org"), MamQueryScheduler::LowPriority);
+
+	// A queued query is moved to the front of the queue.
+	scheduler.prioritize(QStringLiteral("low@example.org"));
+
+	// A query being enqueued later gets the highest priority.
+	scheduler.prioritize(QStringLiteral("later@example.org"));
+	scheduler.enqueue(QStringLiteral("later@example.org"), MamQueryScheduler::LowPriority);
+
+	while (!scheduler.isIdle())
+		QVERIFY(scheduler.finishQuery(startedQueryIds.last()));
+
+	QCOMPARE(startedJids, QStringList({
+		"running@example.org",
+		"low@example.org",
+		"later@example.org",
+		"normal@example.org",
+	}));
+}
+
+void MamQuerySchedulerTest::testProgress()
+{
+	MamQueryScheduler scheduler([this](const QString &jid) { return startQuery(jid); });
+	scheduler.setMaxRunningQueries(1);
+	QSignalSpy progressSpy(&scheduler, &MamQueryScheduler::progressChanged);
+	QSignalSpy finishedSpy(&scheduler, &MamQueryScheduler::allQueriesFinished);
+
+	scheduler.enqueue(QStringLiteral("a@example.org"));
+	scheduler.enqueue(QStringLiteral("b@example.org"));
+
+	QVERIFY(scheduler.finishQuery(startedQueryIds.last()));
+	QCOMPARE(progressSpy.count(), 1);
+	QCOMPARE(progressSpy.last(), QVariantList({ 1, 2, 0 }));
+	QVERIFY(finishedSpy.isEmpty());
+
+	QVERIFY(scheduler.finishQuery(startedQueryIds.last()));
+	QCOMPARE(progressSpy.count(), 2);
+	QCOMPARE(progressSpy.last(), QVariantList({ 2, 2, 0 }));
+	QCOMPARE(finishedSpy.count(), 1);
+
+	// The counters are reset once all queries are finished.
+	scheduler.enqueue(QStringLiteral("c@example.org"));
+	QVERIFY(scheduler.finishQuery(startedQueryIds.last()));
+	QCOMPARE(progressSpy.last(), QVariantList({ 1, 1, 0 }));
+	QCOMPARE(finishedSpy.count(), 2);
+}
+
+void MamQuerySchedulerTest::testRetry()
+{
+	MamQueryScheduler scheduler([this](const QString &jid) { return startQuery(jid); });
+	scheduler.setQueryTimeout(60);
+	QSignalSpy progressSpy(&scheduler, &MamQueryScheduler::progressChanged);
+
+	scheduler.enqueue(QStringLiteral("a@example.org"));
+	const auto firstQueryId = startedQueryIds.last();
+
+	// A query without a result in time is started again.
+	QVERIFY(progressSpy.wait());
+	QCOMPARE(startedJids, QStringList({ "a@example.org", "a@example.org" }));
+	QCOMPARE(progressSpy.last(), QVariantList({ 0, 1, 0 }));
+
+	// Results of the timed out query are ignored.
+	QVERIFY(!scheduler.isQueryRunning(firstQueryId));
+	QVERIFY(!scheduler.finishQuery(firstQueryId));
+
+	QVERIFY(scheduler.isQueryRunning(startedQueryIds.last()));
+	QVERIFY(scheduler.finishQuery(startedQueryIds.last()));
+	QVERIFY(scheduler.isIdle());
+}
+
+void MamQuerySchedulerTest::testGivingUp()
+{
+	MamQueryScheduler scheduler([this](const QString &jid) { return startQuery(jid); });
+	scheduler.setQueryTimeout(60);
+	QSignalSpy finishedSpy(&scheduler, &MamQueryScheduler::allQueriesFinished);
+	QSignalSpy progressSpy(&scheduler, &MamQueryScheduler::progressChanged);
+
+	scheduler.enqueue(QStringLiteral("a@example.org"));
+
+	// A query is given up after its last attempt timed out.
+	QVERIFY(finishedSpy.wait(2000));
+	QCOMPARE(startedJids.size(), 3);
+	QCOMPARE(progressSpy.last(), QVariantList({ 1, 1, 0 }));
+	QVERIFY(scheduler.isIdle());
+
+	// It is not started again.
+	QVERIFY(!progressSpy.wait(200));
+	QCOMPARE(startedJids.size(), 3);
+}
+
+void MamQuerySchedulerTest::testClear()
+{
+	MamQueryScheduler scheduler([this](const QString &jid) { return startQuery(jid); });
+	scheduler.setMaxRunningQueries(1);
+	scheduler.setQueryTimeout(60);
+	QSignalSpy progressSpy(&scheduler, &MamQueryScheduler::progressChanged);
+
+	scheduler.enqueue(QStringLiteral("a@example.org"));
+	scheduler.enqueue(QStringLiteral("b@example.org"));
+	scheduler.clear();
+
+	QVERIFY(scheduler.isIdle());
+	QCOMPARE(scheduler.queueDepth(), 0);
+	QVERIFY(!scheduler.finishQuery(startedQueryIds.last()));
+
+	// Cleared queries do not time out.
+	QVERIFY(!progressSpy.wait(200));
+	QCOMPARE(startedJids.size(), 1);
+}
+
+QString MamQuerySchedulerTest::startQuery(const QString &jid)
+{
+	startedJids << jid;
+	startedQueryIds << QString::number(startedQueryIds.size());
+	return startedQueryIds.last();
+}
+
+QTEST_GUILESS_MAIN(MamQuerySchedulerTest)
+#include "MamQuerySchedulerTest.moc"
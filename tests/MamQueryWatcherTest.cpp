@@ -0,0 +1,105 @@
+// SPDX-FileCopyrightText: 2021 Kaidan developers and contributors
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <QtTest>
+
+#include <QDomDocument>
+
+#include "../src/MamQueryWatcher.h"
+
+class MamQueryWatcherTest : public QObject
+{
+	Q_OBJECT
+
+private:
+	Q_SLOT void testErrorResponse();
+	Q_SLOT void testOtherStanzas();
+	Q_SLOT void testTimeout();
+	Q_SLOT void testFinish();
+
+	static QDomElement parse(const QString &xml);
+};
+
+void MamQueryWatcherTest::testErrorResponse()
+{
+	MamQueryWatcher watcher;
+	QSignalSpy failedSpy(&watcher, &MamQueryWatcher::queryFailed);
+
+	watcher.watch(QStringLiteral("query1"));
+	QCOMPARE(watcher.queryId(), QStringLiteral("query1"));
+
+	// e.g., the archive does not know the message after which the query should start
+	QVERIFY(watcher.handleStanza(parse(QStringLiteral(
+		"<iq type='error' id='query1'>"
+		"<error type='cancel'><item-not-found xmlns='urn:ietf:params:xml:ns:xmpp-stanzas'/></error>"
+		"</iq>"))));
+
+	QCOMPARE(failedSpy.size(), 1);
+	QCOMPARE(failedSpy.at(0).at(0).toString(), QStringLiteral("query1"));
+	QVERIFY(watcher.queryId().isEmpty());
+
+	// A failed query is reported only once.
+	QVERIFY(!watcher.handleStanza(parse(QStringLiteral("<iq type='error' id='query1'/>"))));
+	QCOMPARE(failedSpy.size(), 1);
+}
+
+void MamQueryWatcherTest::testOtherStanzas()
+{
+	MamQueryWatcher watcher;
+	QSignalSpy failedSpy(&watcher, &MamQueryWatcher::queryFailed);
+
+	// Nothing is handled without a watched query.
+	QVERIFY(!watcher.handleStanza(parse(QStringLiteral("<iq type='error' id='query1'/>"))));
+
+	watcher.watch(QStringLiteral("query1"));
+
+	QVERIFY(!watcher.handleStanza(parse(QStringLiteral("<iq type='error' id='query2'/>"))));
+	QVERIFY(!watcher.handleStanza(parse(QStringLiteral(
+		"<iq type='result' id='query1'><fin xmlns='urn:xmpp:mam:2' complete='true'/></iq>"))));
+	QVERIFY(!watcher.handleStanza(parse(QStringLiteral("<message type='error' id='query1'/>"))));
+
+	QCOMPARE(failedSpy.size(), 0);
+	QCOMPARE(watcher.queryId(), QStringLiteral("query1"));
+}
+
+void MamQueryWatcherTest::testTimeout()
+{
+	MamQueryWatcher watcher;
+	watcher.setQueryTimeout(60);
+	QCOMPARE(watcher.queryTimeout(), 60);
+
+	QSignalSpy failedSpy(&watcher, &MamQueryWatcher::queryFailed);
+
+	watcher.watch(QStringLiteral("query1"));
+	QVERIFY(failedSpy.wait(2000));
+	QCOMPARE(failedSpy.at(0).at(0).toString(), QStringLiteral("query1"));
+	QVERIFY(watcher.queryId().isEmpty());
+}
+
+void MamQueryWatcherTest::testFinish()
+{
+	MamQueryWatcher watcher;
+	watcher.setQueryTimeout(60);
+
+	QSignalSpy failedSpy(&watcher, &MamQueryWatcher::queryFailed);
+
+	watcher.watch(QStringLiteral("query1"));
+	watcher.finish();
+	QVERIFY(watcher.queryId().isEmpty());
+
+	// A finished query neither times out nor fails by a later error.
+	QVERIFY(!failedSpy.wait(200));
+	QVERIFY(!watcher.handleStanza(parse(QStringLiteral("<iq type='error' id='query1'/>"))));
+	QCOMPARE(failedSpy.size(), 0);
+}
+
+QDomElement MamQueryWatcherTest::parse(const QString &xml)
+{
+	QDomDocument document;
+	document.setContent(xml, true);
+	return document.documentElement();
+}
+
+QTEST_GUILESS_MAIN(MamQueryWatcherTest)
+#include "MamQueryWatcherTest.moc"
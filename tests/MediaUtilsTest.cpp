@@ -0,0 +1,73 @@
+// SPDX-FileCopyrightText: 2021 Kaidan developers and contributors
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <QtTest>
+
+#include "../src/MediaUtils.h"
+
+using UriSpans = QVector<QPair<int, QString>>;
+
+class MediaUtilsTest : public QObject
+{
+	Q_OBJECT
+
+private:
+	Q_SLOT void testFindUris_data();
+	Q_SLOT void testFindUris();
+};
+
+void MediaUtilsTest::testFindUris_data()
+{
+	QTest::addColumn<QString>("text");
+	// positions and texts of the expected URIs
+	QTest::addColumn<UriSpans>("expectedUris");
+
+	QTest::newRow("empty") << QString() << UriSpans();
+	QTest::newRow("no colon") << QStringLiteral("hello world") << UriSpans();
+	QTest::newRow("no URI") << QStringLiteral("note: nothing here") << UriSpans();
+	QTest::newRow("only URI")
+		<< QStringLiteral("https://kaidan.im")
+		<< UriSpans({ { 0, QStringLiteral("https://kaidan.im") } });
+	QTest::newRow("URI within text")
+		<< QStringLiteral("see http://example.org/a?b=c for details")
+		<< UriSpans({ { 4, QStringLiteral("http://example.org/a?b=c") } });
+	QTest::newRow("multiple URIs and whitespace")
+		<< QStringLiteral("  https://a.example\n\thttp://b.example  ")
+		<< UriSpans({ { 2, QStringLiteral("https://a.example") }, { 21, QStringLiteral("http://b.example") } });
+	QTest::newRow("case-insensitive scheme")
+		<< QStringLiteral("HTTPS://KAIDAN.IM")
+		<< UriSpans({ { 0, QStringLiteral("HTTPS://KAIDAN.IM") } });
+	QTest::newRow("scheme not at word start")
+		<< QStringLiteral("xhttps://kaidan.im (https://kaidan.im)")
+		<< UriSpans();
+	QTest::newRow("geo URI")
+		<< QStringLiteral("I am at geo:48.208174,16.373819 now")
+		<< UriSpans({ { 8, QStringLiteral("geo:48.208174,16.373819") } });
+	QTest::newRow("invalid geo URI")
+		<< QStringLiteral("geo:somewhere")
+		<< UriSpans();
+	QTest::newRow("unsupported scheme")
+		<< QStringLiteral("mailto:a@example.org xmpp:b@example.org")
+		<< UriSpans();
+}
+
+void MediaUtilsTest::testFindUris()
+{
+	QFETCH(QString, text);
+	QFETCH(UriSpans, expectedUris);
+
+	const auto uris = MediaUtils::findUris(text);
+	QCOMPARE(uris.size(), expectedUris.size());
+
+	for (int i = 0; i < uris.size(); i++) {
+		const auto &[expectedPosition, expectedUri] = expectedUris.at(i);
+		QCOMPARE(uris.at(i).position, expectedPosition);
+		QCOMPARE(uris.at(i).length, expectedUri.size());
+		QCOMPARE(text.mid(uris.at(i).position, uris.at(i).length), expectedUri);
+		QCOMPARE(uris.at(i).url, QUrl(expectedUri));
+	}
+}
+
+QTEST_GUILESS_MAIN(MediaUtilsTest)
+#include "MediaUtilsTest.moc"
@@ -0,0 +1,268 @@
+// SPDX-FileCopyrightText: 2021 Kaidan developers and contributors
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <QtTest>
+
+#include <QXmlStreamWriter>
+
+#include <QXmppClient.h>
+#include <QXmppLogger.h>
+
+#include "../src/DeliveryStateAggregator.h"
+#include "../src/MessageOutbox.h"
+#include "../src/StreamTracker.h"
+
+class MessageOutboxTest : public QObject
+{
+	Q_OBJECT
+
+private:
+	Q_SLOT void initTestCase();
+	Q_SLOT void init();
+	Q_SLOT void cleanup();
+	Q_SLOT void testPaging();
+	Q_SLOT void testAcknowledgement();
+	Q_SLOT void testDelivery();
+	Q_SLOT void testEnqueueing();
+	Q_SLOT void testOutdatedPage();
+	Q_SLOT void testFailedResumption();
+	Q_SLOT void testSendingFailure();
+
+	bool send(const Message &message);
+	void log(QXmppLogger::MessageType type, const QString &text);
+	void enableStreamManagement();
+	void acknowledge(quint32 handledStanzas);
+	DeliveryStateUpdates flushDeliveryStates();
+
+	static QVector<Message> createMessages(int first, int count);
+
+	QXmppClient *client = nullptr;
+	StreamTracker *tracker = nullptr;
+	DeliveryStateAggregator *aggregator = nullptr;
+	MessageOutbox *outbox = nullptr;
+
+	QStringList sentMessageIds;
+	bool isSendingSuccessful = true;
+};
+
+void MessageOutboxTest::initTestCase()
+{
+	qRegisterMetaType<DeliveryStateUpdates>();
+}
+
+void MessageOutboxTest::init()
+{
+	// The logger is not set up for logging since the tracker has to do that itself.
+	client = new QXmppClient;
+	auto *logger = new QXmppLogger(client);
+	logger->setLoggingType(QXmppLogger::NoLogging);
+	logger->setMessageTypes(QXmppLogger::NoMessage);
+	client->setLogger(logger);
+
+	tracker = new StreamTracker(client, client);
+	aggregator = new DeliveryStateAggregator(client);
+	outbox = new MessageOutbox(client, [this](const Message &message) {
+		return send(message);
+	}, tracker, aggregator, client);
+
+	sentMessageIds.clear();
+	isSendingSuccessful = true;
+}
+
+void MessageOutboxTest::cleanup()
+{
+	delete client;
+}
+
+void MessageOutboxTest::testPaging()
+{
+	QSignalSpy fetchSpy(outbox, &MessageOutbox::fetchPendingMessagesRequested);
+
+	outbox->sendPendingMessages();
+	QCOMPARE(fetchSpy.count(), 1);
+	QCOMPARE(fetchSpy.last(), QVariantList({ 0, 50 }));
+
+	// Without Stream Management, all messages are sent at once and the next page is
+	// requested as soon as the queue runs low.
+	outbox->handlePendingMessagesFetched(createMessages(0, 50), 50);
+	QCOMPARE(sentMessageIds.size(), 50);
+	QCOMPARE(fetchSpy.count(), 2);
+	QCOMPARE(fetchSpy.last(), QVariantList({ 50, 50 }));
+
+	// An incomplete page is the last one.
+	outbox->handlePendingMessagesFetched(createMessages(50, 3), 53);
+	QCOMPARE(sentMessageIds.size(), 53);
+	QCOMPARE(fetchSpy.count(), 2);
+
+	// Messages are marked as sent as soon as they are written to the stream.
+	const auto updates = flushDeliveryStates();
+	QCOMPARE(updates.size(), 53);
+	QCOMPARE(updates.value(QStringLiteral("52")).deliveryState, Enums::DeliveryState::Sent);
+}
+
+void MessageOutboxTest::testAcknowledgement()
+{
+	enableStreamManagement();
+	outbox->sendPendingMessages();
+	outbox->handlePendingMessagesFetched(createMessages(0, 15), 15);
+
+	// Only a limited number of messages is sent without being acknowledged.
+	QCOMPARE(sentMessageIds.size(), 10);
+	QVERIFY(flushDeliveryStates().isEmpty());
+
+	// Acknowledged messages are marked as sent and the next ones are sent.
+	acknowledge(4);
+	QCOMPARE(sentMessageIds.size(), 14);
+
+	const auto updates = flushDeliveryStates();
+	QCOMPARE(updates.size(), 4);
+	for (int i = 0; i < 4; i++)
+		QCOMPARE(updates.value(QString::number(i)).deliveryState, Enums::DeliveryState::Sent);
+
+	acknowledge(14);
+	QCOMPARE(sentMessageIds.size(), 15);
+	QCOMPARE(flushDeliveryStates().size(), 10);
+
+	acknowledge(15);
+	QCOMPARE(flushDeliveryStates().size(), 1);
+}
+
+void MessageOutboxTest::testDelivery()
+{
+	enableStreamManagement();
+	outbox->sendPendingMessages();
+	outbox->handlePendingMessagesFetched(createMessages(0, 11), 11);
+	QCOMPARE(sentMessageIds.size(), 10);
+
+	// A message delivered to its recipient does not need to be acknowledged anymore.
+	outbox->handleMessageDelivered(QStringLiteral("3"));
+	QCOMPARE(sentMessageIds.size(), 11);
+
+	// Its acknowledgement does not change its delivery state.
+	acknowledge(4);
+	const auto updates = flushDeliveryStates();
+	QCOMPARE(updates.size(), 3);
+	QVERIFY(!updates.contains(QStringLiteral("3")));
+}
+
+void MessageOutboxTest::testEnqueueing()
+{
+	// Messages enqueued while being disconnected are loaded from the database later.
+	outbox->enqueue(createMessages(0, 1).first());
+	QVERIFY(sentMessageIds.isEmpty());
+
+	outbox->sendPendingMessages();
+	outbox->enqueue(createMessages(1, 1).first());
+	QCOMPARE(sentMessageIds, QStringList({ "1" }));
+
+	// Messages enqueued directly while loading the page are not sent again.
+	outbox->handlePendingMessagesFetched(createMessages(0, 2), 2);
+	QCOMPARE(sentMessageIds, QStringList({ "1", "0" }));
+}
+
+void MessageOutboxTest::testOutdatedPage()
+{
+	QSignalSpy fetchSpy(outbox, &MessageOutbox::fetchPendingMessagesRequested);
+
+	outbox->sendPendingMessages();
+	emit client->disconnected();
+	outbox->sendPendingMessages();
+	QCOMPARE(fetchSpy.count(), 2);
+	QCOMPARE(fetchSpy.last(), QVariantList({ 0, 50 }));
+
+	// The page requested before the connection loss is ignored.
+	outbox->handlePendingMessagesFetched(createMessages(0, 50), 50);
+	QVERIFY(sentMessageIds.isEmpty());
+	QCOMPARE(fetchSpy.count(), 2);
+
+	// The page requested after reconnecting is used.
+	outbox->handlePendingMessagesFetched(createMessages(0, 2), 2);
+	QCOMPARE(sentMessageIds, QStringList({ "0", "1" }));
+}
+
+void MessageOutboxTest::testFailedResumption()
+{
+	enableStreamManagement();
+	outbox->sendPendingMessages();
+	outbox->handlePendingMessagesFetched(createMessages(0, 3), 3);
+	QVERIFY(flushDeliveryStates().isEmpty());
+
+	// QXmpp sends unacknowledged stanzas again via the new stream if it could not be
+	// resumed.
+	log(QXmppLogger::ReceivedMessage, QStringLiteral("<failed xmlns='urn:xmpp:sm:3'/>"));
+
+	const auto updates = flushDeliveryStates();
+	QCOMPARE(updates.size(), 3);
+	QCOMPARE(updates.value(QStringLiteral("0")).deliveryState, Enums::DeliveryState::Sent);
+}
+
+void MessageOutboxTest::testSendingFailure()
+{
+	QSignalSpy failureSpy(outbox, &MessageOutbox::sendingFailed);
+	isSendingSuccessful = false;
+
+	outbox->sendPendingMessages();
+	outbox->handlePendingMessagesFetched(createMessages(0, 2), 2);
+
+	QCOMPARE(failureSpy.count(), 2);
+	QCOMPARE(failureSpy.first().first().toString(), QStringLiteral("0"));
+	QVERIFY(flushDeliveryStates().isEmpty());
+}
+
+bool MessageOutboxTest::send(const Message &message)
+{
+	if (!isSendingSuccessful)
+		return false;
+
+	// The stanza is serialized and logged the same way as by QXmppStream::sendPacket() so
+	// that it is counted by the tracker as if QXmpp sent it.
+	QByteArray data;
+	QXmlStreamWriter writer(&data);
+	message.toXml(&writer);
+	log(QXmppLogger::SentMessage, QString::fromUtf8(data));
+
+	sentMessageIds << message.id();
+	return true;
+}
+
+void MessageOutboxTest::log(QXmppLogger::MessageType type, const QString &text)
+{
+	// The client forwards the log messages of its stream to its logger.
+	emit client->logMessage(type, text);
+}
+
+void MessageOutboxTest::enableStreamManagement()
+{
+	log(QXmppLogger::SentMessage, QStringLiteral("<enable xmlns='urn:xmpp:sm:3' resume='true'/>"));
+	log(QXmppLogger::ReceivedMessage, QStringLiteral("<enabled xmlns='urn:xmpp:sm:3' id='1' resume='true'/>"));
+	QVERIFY(tracker->isEnabled());
+}
+
+void MessageOutboxTest::acknowledge(quint32 handledStanzas)
+{
+	log(QXmppLogger::ReceivedMessage, QStringLiteral("<a xmlns='urn:xmpp:sm:3' h='%1'/>").arg(handledStanzas));
+}
+
+DeliveryStateUpdates MessageOutboxTest::flushDeliveryStates()
+{
+	QSignalSpy spy(aggregator, &DeliveryStateAggregator::deliveryStatesChanged);
+	aggregator->flush();
+	return spy.isEmpty() ? DeliveryStateUpdates() : spy.first().first().value<DeliveryStateUpdates>();
+}
+
+QVector<Message> MessageOutboxTest::createMessages(int first, int count)
+{
+	QVector<Message> messages;
+	for (int i = first; i < first + count; i++) {
+		Message message;
+		message.setId(QString::number(i));
+		message.setTo(QStringLiteral("bob@example.org"));
+		message.setBody(QStringLiteral("Hello"));
+		messages << message;
+	}
+	return messages;
+}
+
+QTEST_GUILESS_MAIN(MessageOutboxTest)
+#include "MessageOutboxTest.moc"
@@ -0,0 +1,230 @@
+// SPDX-FileCopyrightText: 2021 Kaidan developers and contributors
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <QtTest>
+
+#include <QImage>
+#include <QVideoFrame>
+
+#include "../src/QrCodeVideoFrame.h"
+
+#include <algorithm>
+
+Q_DECLARE_METATYPE(QVideoFrame::PixelFormat)
+
+class QrCodeVideoFrameTest : public QObject
+{
+	Q_OBJECT
+
+private:
+	Q_SLOT void testRgbConversion_data();
+	Q_SLOT void testRgbConversion();
+	Q_SLOT void testYPlane_data();
+	Q_SLOT void testYPlane();
+	Q_SLOT void testCaptureRect();
+	Q_SLOT void testDownscaling();
+	Q_SLOT void benchmarkConversion_data();
+	Q_SLOT void benchmarkConversion();
+
+	static int bytesPerLine(QVideoFrame::PixelFormat format, int width);
+	static int frameSize(QVideoFrame::PixelFormat format, int width, int height);
+	static QVideoFrame createFrame(QVideoFrame::PixelFormat format, const QSize &size);
+};
+
+void QrCodeVideoFrameTest::testRgbConversion_data()
+{
+	QTest::addColumn<QVideoFrame::PixelFormat>("format");
+	QTest::addColumn<int>("bytesPerPixel");
+	QTest::addColumn<int>("red");
+	QTest::addColumn<int>("green");
+	QTest::addColumn<int>("blue");
+
+	QTest::newRow("RGB32") << QVideoFrame::Format_RGB32 << 4 << 1 << 2 << 3;
+	QTest::newRow("BGRA32") << QVideoFrame::Format_BGRA32 << 4 << 2 << 1 << 0;
+	QTest::newRow("ABGR32") << QVideoFrame::Format_ABGR32 << 4 << 3 << 2 << 1;
+	QTest::newRow("RGB24") << QVideoFrame::Format_RGB24 << 3 << 0 << 1 << 2;
+	QTest::newRow("BGR24") << QVideoFrame::Format_BGR24 << 3 << 2 << 1 << 0;
+}
+
+void QrCodeVideoFrameTest::testRgbConversion()
+{
+	QFETCH(QVideoFrame::PixelFormat, format);
+	QFETCH(int, bytesPerPixel);
+	QFETCH(int, red);
+	QFETCH(int, green);
+	QFETCH(int, blue);
+
+	// The width is chosen so that the vectorized and the scalar conversion are used.
+	const QSize size(37, 5);
+	auto frame = createFrame(format, size);
+
+	QrCodeVideoFrame videoFrame;
+	videoFrame.setData(frame);
+
+	const QImage &image = videoFrame.toGrayscaleImage();
+	QCOMPARE(image.size(), size);
+
+	const auto *data = reinterpret_cast<const uchar *>(videoFrame.data().constData());
+	const int sourceBytesPerLine = bytesPerLine(format, size.width());
+
+	for (int y = 0; y < size.height(); y++) {
+#ifdef Q_OS_IOS
+		const uchar *grayRow = image.constScanLine(y);
+#else
+		const uchar *grayRow = image.constScanLine(size.height() - y - 1);
+#endif
+		for (int x = 0; x < size.width(); x++) {
+			const uchar *pixel = data + y * sourceBytesPerLine + x * bytesPerPixel;
+			const int expected = (306 * pixel[red] + 601 * pixel[green] + 117 * pixel[blue] + 0x200) >> 10;
+			QCOMPARE(int(grayRow[x]), expected);
+		}
+	}
+}
+
+void QrCodeVideoFrameTest::testYPlane_data()
+{
+	QTest::addColumn<QVideoFrame::PixelFormat>("format");
+
+	QTest::newRow("YUV420P") << QVideoFrame::Format_YUV420P;
+	QTest::newRow("NV12") << QVideoFrame::Format_NV12;
+	QTest::newRow("NV21") << QVideoFrame::Format_NV21;
+}
+
+void QrCodeVideoFrameTest::testYPlane()
+{
+	QFETCH(QVideoFrame::PixelFormat, format);
+
+	const QSize size(64, 8);
+	auto frame = createFrame(format, size);
+
+	QrCodeVideoFrame videoFrame;
+	videoFrame.setData(frame);
+
+	const QImage &image = videoFrame.toGrayscaleImage();
+	QCOMPARE(image.size(), size);
+
+	// The Y plane is used without copying it.
+	QCOMPARE(image.constBits(), reinterpret_cast<const uchar *>(videoFrame.data().constData()));
+}
+
+void QrCodeVideoFrameTest::testCaptureRect()
+{
+	const QSize size(64, 8);
+	auto frame = createFrame(QVideoFrame::Format_NV12, size);
+
+	QrCodeVideoFrame videoFrame;
+	videoFrame.setData(frame, QRectF(0.25, 0.25, 0.5, 0.5));
+
+	// Only the Y values within the capture rectangle are copied.
+	QCOMPARE(videoFrame.size(), QSize(32, 4));
+	QCOMPARE(videoFrame.data().size(), 32 * 4);
+
+	const QImage &image = videoFrame.toGrayscaleImage();
+	QCOMPARE(image.size(), QSize(32, 4));
+
+	frame.map(QAbstractVideoBuffer::ReadOnly);
+	for (int y = 0; y < image.height(); y++) {
+		const uchar *yRow = frame.bits() + (y + 2) * frame.bytesPerLine() + 16;
+		QVERIFY(std::equal(yRow, yRow + image.width(), image.constScanLine(y)));
+	}
+	frame.unmap();
+}
+
+void QrCodeVideoFrameTest::testDownscaling()
+{
+	const QSize size(64, 8);
+	auto frame = createFrame(QVideoFrame::Format_Y8, size);
+
+	QrCodeVideoFrame videoFrame;
+	videoFrame.setData(frame);
+
+	const QImage &image = videoFrame.toGrayscaleImage();
+	const QImage &downscaledImage = videoFrame.toDownscaledGrayscaleImage();
+	QCOMPARE(downscaledImage.size(), size / 2);
+
+	for (int y = 0; y < downscaledImage.height(); y++) {
+		for (int x = 0; x < downscaledImage.width(); x++) {
+			const int sum = image.constScanLine(y * 2)[x * 2] + image.constScanLine(y * 2)[x * 2 + 1]
+				+ image.constScanLine(y * 2 + 1)[x * 2] + image.constScanLine(y * 2 + 1)[x * 2 + 1];
+			QCOMPARE(int(downscaledImage.constScanLine(y)[x]), (sum + 2) / 4);
+		}
+	}
+}
+
+void QrCodeVideoFrameTest::benchmarkConversion_data()
+{
+	QTest::addColumn<QVideoFrame::PixelFormat>("format");
+
+	QTest::newRow("RGB32") << QVideoFrame::Format_RGB32;
+	QTest::newRow("BGRA32") << QVideoFrame::Format_BGRA32;
+	QTest::newRow("ARGB32_Premultiplied") << QVideoFrame::Format_ARGB32_Premultiplied;
+	QTest::newRow("RGB24") << QVideoFrame::Format_RGB24;
+	QTest::newRow("BGR24") << QVideoFrame::Format_BGR24;
+	QTest::newRow("YUV420P") << QVideoFrame::Format_YUV420P;
+	QTest::newRow("NV12") << QVideoFrame::Format_NV12;
+	QTest::newRow("YUYV") << QVideoFrame::Format_YUYV;
+}
+
+void QrCodeVideoFrameTest::benchmarkConversion()
+{
+	QFETCH(QVideoFrame::PixelFormat, format);
+
+	const QSize size(1920, 1080);
+	auto frame = createFrame(format, size);
+
+	QrCodeVideoFrame videoFrame;
+	videoFrame.setData(frame);
+
+	QBENCHMARK {
+		QCOMPARE(videoFrame.toGrayscaleImage().size(), size);
+	}
+}
+
+int QrCodeVideoFrameTest::bytesPerLine(QVideoFrame::PixelFormat format, int width)
+{
+	switch (format) {
+	case QVideoFrame::Format_RGB24:
+	case QVideoFrame::Format_BGR24:
+		return width * 3;
+	case QVideoFrame::Format_YUYV:
+		return width * 2;
+	case QVideoFrame::Format_YUV420P:
+	case QVideoFrame::Format_NV12:
+	case QVideoFrame::Format_NV21:
+	case QVideoFrame::Format_Y8:
+		return width;
+	default:
+		return width * 4;
+	}
+}
+
+int QrCodeVideoFrameTest::frameSize(QVideoFrame::PixelFormat format, int width, int height)
+{
+	switch (format) {
+	case QVideoFrame::Format_YUV420P:
+	case QVideoFrame::Format_NV12:
+	case QVideoFrame::Format_NV21:
+		// Y plane followed by the chroma planes of a quarter of its size
+		return width * height * 3 / 2;
+	default:
+		return bytesPerLine(format, width) * height;
+	}
+}
+
+QVideoFrame QrCodeVideoFrameTest::createFrame(QVideoFrame::PixelFormat format, const QSize &size)
+{
+	const int bytes = frameSize(format, size.width(), size.height());
+	QVideoFrame frame(bytes, size, bytesPerLine(format, size.width()), format);
+
+	frame.map(QAbstractVideoBuffer::WriteOnly);
+	uchar *data = frame.bits();
+	for (int i = 0; i < bytes; i++)
+		data[i] = uchar((i * 7 + i / 13) & 0xff);
+	frame.unmap();
+
+	return frame;
+}
+
+QTEST_GUILESS_MAIN(QrCodeVideoFrameTest)
+#include "QrCodeVideoFrameTest.moc"
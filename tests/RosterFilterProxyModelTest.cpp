@@ -0,0 +1,172 @@
+// SPDX-FileCopyrightText: 2021 Kaidan developers and contributors
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <QtTest>
+
+#include <QStandardItemModel>
+
+#include "../src/RosterFilterProxyModel.h"
+#include "../src/RosterItem.h"
+#include "../src/RosterModel.h"
+
+class RosterFilterProxyModelTest : public QObject
+{
+	Q_OBJECT
+
+private:
+	Q_SLOT void init();
+	Q_SLOT void testMatchScore();
+	Q_SLOT void testAllOccurrences();
+	Q_SLOT void testRanking();
+	Q_SLOT void testNarrowing();
+	Q_SLOT void testClearing();
+
+	void addItem(const QString &name, const QString &jid);
+	QStringList filteredKeys() const;
+	QStringList freshlyFilteredKeys(const QString &searchText);
+
+	static QString searchKey(const QString &name, const QString &jid);
+
+	QStandardItemModel sourceModel;
+	RosterFilterProxyModel proxyModel;
+};
+
+void RosterFilterProxyModelTest::init()
+{
+	proxyModel.setSearchText({});
+	proxyModel.setSourceModel(nullptr);
+	sourceModel.clear();
+
+	addItem(QStringLiteral("Alice"), QStringLiteral("alice@example.org"));
+	addItem(QStringLiteral("Johanna"), QStringLiteral("jo@example.org"));
+	addItem(QStringLiteral("Bob"), QStringLiteral("anna@example.org"));
+	addItem(QStringLiteral("Ánnabelle"), QStringLiteral("belle@example.org"));
+	addItem(QStringLiteral("Carl"), QStringLiteral("a.n.n@example.org"));
+	addItem(QStringLiteral("Dave"), QStringLiteral("dave@example.org"));
+
+	proxyModel.setSourceModel(&sourceModel);
+}
+
+void RosterFilterProxyModelTest::testMatchScore()
+{
+	const auto score = [](const QString &name, const QString &jid, const QString &searchText) {
+		return RosterFilterProxyModel::matchScore(searchKey(name, jid), searchText);
+	};
+
+	const int keyPrefix = score(QStringLiteral("Anna"), QStringLiteral("a@example.org"), QStringLiteral("anna"));
+	const int wordPrefix = score(QStringLiteral("Bob"), QStringLiteral("anna@example.org"), QStringLiteral("anna"));
+	const int substring = score(QStringLiteral("Johanna"), QStringLiteral("jo@example.org"), QStringLiteral("anna"));
+	const int subsequence = score(QStringLiteral("Carl"), QStringLiteral("a.n.n.a@example.org"), QStringLiteral("anna"));
+
+	QVERIFY(keyPrefix > wordPrefix);
+	QVERIFY(wordPrefix > substring);
+	QVERIFY(substring > subsequence);
+	QVERIFY(subsequence > 0);
+
+	// Words of the name are matched like the JID.
+	QCOMPARE(score(QStringLiteral("Mary Anna"), QStringLiteral("m@example.org"), QStringLiteral("anna")), wordPrefix);
+
+	// Subsequences with less characters in between are preferred.
+	QVERIFY(score(QStringLiteral("Carl"), QStringLiteral("an.na@example.org"), QStringLiteral("anna")) > subsequence);
+
+	QCOMPARE(score(QStringLiteral("Dave"), QStringLiteral("dave@example.org"), QStringLiteral("anna")), 0);
+}
+
+void RosterFilterProxyModelTest::testAllOccurrences()
+{
+	// The first occurrence is within the name while the JID starts with the search text.
+	QCOMPARE(RosterFilterProxyModel::matchScore(searchKey(QStringLiteral("Johanna"), QStringLiteral("anna@example.org")), QStringLiteral("anna")),
+	         RosterFilterProxyModel::matchScore(searchKey(QStringLiteral("Bob"), QStringLiteral("anna@example.org")), QStringLiteral("anna")));
+
+	// The first occurrence is within a word while a later one starts a word.
+	QCOMPARE(RosterFilterProxyModel::matchScore(searchKey(QStringLiteral("Johanna Anna"), QStringLiteral("j@example.org")), QStringLiteral("anna")),
+	         RosterFilterProxyModel::matchScore(searchKey(QStringLiteral("Bob"), QStringLiteral("anna@example.org")), QStringLiteral("anna")));
+}
+
+void RosterFilterProxyModelTest::testRanking()
+{
+	QCOMPARE(proxyModel.rowCount(), sourceModel.rowCount());
+
+	proxyModel.setSearchText(QStringLiteral("Anna"));
+
+	// Diacritics and the case are ignored and items with equal scores keep their order.
+	QCOMPARE(filteredKeys(), QStringList({
+		searchKey(QStringLiteral("Ánnabelle"), QStringLiteral("belle@example.org")),
+		searchKey(QStringLiteral("Bob"), QStringLiteral("anna@example.org")),
+		searchKey(QStringLiteral("Johanna"), QStringLiteral("jo@example.org")),
+		searchKey(QStringLiteral("Carl"), QStringLiteral("a.n.n@example.org")),
+	}));
+}
+
+void RosterFilterProxyModelTest::testNarrowing()
+{
+	// Extending the search text only checks the items matching before. The result must
+	// be the same as for filtering all items.
+	QString searchText;
+	for (const auto character : QStringLiteral("ann")) {
+		searchText.append(character);
+		proxyModel.setSearchText(searchText);
+		QCOMPARE(filteredKeys(), freshlyFilteredKeys(searchText));
+	}
+
+	// Shortening the search text checks all items again.
+	proxyModel.setSearchText(QStringLiteral("an"));
+	QCOMPARE(filteredKeys(), freshlyFilteredKeys(QStringLiteral("an")));
+
+	// Replacing the search text checks all items again.
+	proxyModel.setSearchText(QStringLiteral("dave"));
+	QCOMPARE(filteredKeys(), QStringList({ searchKey(QStringLiteral("Dave"), QStringLiteral("dave@example.org")) }));
+
+	// Items added while narrowing are checked as well.
+	proxyModel.setSearchText(QStringLiteral("d"));
+	addItem(QStringLiteral("Dan"), QStringLiteral("dan@example.org"));
+	proxyModel.setSearchText(QStringLiteral("da"));
+	QCOMPARE(filteredKeys(), freshlyFilteredKeys(QStringLiteral("da")));
+}
+
+void RosterFilterProxyModelTest::testClearing()
+{
+	proxyModel.setSearchText(QStringLiteral("anna"));
+	proxyModel.setSearchText({});
+
+	// The roster's order is restored.
+	QCOMPARE(proxyModel.rowCount(), sourceModel.rowCount());
+	for (int row = 0; row < proxyModel.rowCount(); row++)
+		QCOMPARE(proxyModel.mapToSource(proxyModel.index(row, 0)).row(), row);
+}
+
+void RosterFilterProxyModelTest::addItem(const QString &name, const QString &jid)
+{
+	auto *item = new QStandardItem;
+	item->setData(searchKey(name, jid), RosterModel::SearchKeyRole);
+	sourceModel.appendRow(item);
+}
+
+QStringList RosterFilterProxyModelTest::filteredKeys() const
+{
+	QStringList keys;
+	for (int row = 0; row < proxyModel.rowCount(); row++)
+		keys << proxyModel.index(row, 0).data(RosterModel::SearchKeyRole).toString();
+	return keys;
+}
+
+QStringList RosterFilterProxyModelTest::freshlyFilteredKeys(const QString &searchText)
+{
+	RosterFilterProxyModel freshProxyModel;
+	freshProxyModel.setSourceModel(&sourceModel);
+	freshProxyModel.setSearchText(searchText);
+
+	QStringList keys;
+	for (int row = 0; row < freshProxyModel.rowCount(); row++)
+		keys << freshProxyModel.index(row, 0).data(RosterModel::SearchKeyRole).toString();
+	return keys;
+}
+
+QString RosterFilterProxyModelTest::searchKey(const QString &name, const QString &jid)
+{
+	return RosterItem::foldForSearch(name) + QLatin1Char('\n') + RosterItem::foldForSearch(jid);
+}
+
+QTEST_GUILESS_MAIN(RosterFilterProxyModelTest)
+#include "RosterFilterProxyModelTest.moc"
@@ -0,0 +1,163 @@
+// SPDX-FileCopyrightText: 2021 Kaidan developers and contributors
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <QtTest>
+
+#include <QXmlStreamWriter>
+
+#include <QXmppClient.h>
+#include <QXmppIq.h>
+#include <QXmppLogger.h>
+#include <QXmppMessage.h>
+#include <QXmppPresence.h>
+
+#include "../src/StreamTracker.h"
+
+class StreamTrackerTest : public QObject
+{
+	Q_OBJECT
+
+private:
+	Q_SLOT void init();
+	Q_SLOT void cleanup();
+	Q_SLOT void testLoggerSetup();
+	Q_SLOT void testLoggerChange();
+	Q_SLOT void testSentStanzas();
+	Q_SLOT void testResumption();
+	Q_SLOT void testStreamFeatures();
+
+	template<typename Stanza>
+	void logSent(const Stanza &stanza);
+	void log(QXmppLogger::MessageType type, const QString &text);
+	void enableStreamManagement();
+
+	QXmppClient *client = nullptr;
+	StreamTracker *tracker = nullptr;
+};
+
+void StreamTrackerTest::init()
+{
+	client = new QXmppClient;
+	auto *logger = new QXmppLogger(client);
+	logger->setLoggingType(QXmppLogger::NoLogging);
+	logger->setMessageTypes(QXmppLogger::NoMessage);
+	client->setLogger(logger);
+
+	tracker = new StreamTracker(client, client);
+}
+
+void StreamTrackerTest::cleanup()
+{
+	delete client;
+}
+
+void StreamTrackerTest::testLoggerSetup()
+{
+	// The tracker works without any logging set up by others.
+	QCOMPARE(client->logger()->loggingType(), QXmppLogger::SignalLogging);
+	QVERIFY(client->logger()->messageTypes().testFlag(QXmppLogger::SentMessage));
+	QVERIFY(client->logger()->messageTypes().testFlag(QXmppLogger::ReceivedMessage));
+
+	enableStreamManagement();
+}
+
+void StreamTrackerTest::testLoggerChange()
+{
+	auto *logger = new QXmppLogger(client);
+	logger->setLoggingType(QXmppLogger::NoLogging);
+	logger->setMessageTypes(QXmppLogger::NoMessage);
+	client->setLogger(logger);
+
+	QCOMPARE(logger->loggingType(), QXmppLogger::SignalLogging);
+	enableStreamManagement();
+}
+
+void StreamTrackerTest::testSentStanzas()
+{
+	enableStreamManagement();
+
+	// The stanzas are logged in the format used by QXmpp.
+	logSent(QXmppMessage(QString(), QStringLiteral("alice@example.org"), QStringLiteral("Hello")));
+	logSent(QXmppPresence());
+	logSent(QXmppIq());
+	QCOMPARE(tracker->sentStanzas(), quint32(3));
+
+	QSignalSpy acknowledgedSpy(tracker, &StreamTracker::acknowledged);
+	log(QXmppLogger::ReceivedMessage, QStringLiteral("<a xmlns='urn:xmpp:sm:3' h='2'/>"));
+	QCOMPARE(acknowledgedSpy.size(), 1);
+	QCOMPARE(acknowledgedSpy.at(0).at(0).toUInt(), 2u);
+
+	// Closing the stream prevents resuming it.
+	log(QXmppLogger::SentMessage, QStringLiteral("</stream:stream>"));
+	QVERIFY(!tracker->isResumptionPossible());
+}
+
+void StreamTrackerTest::testResumption()
+{
+	enableStreamManagement();
+
+	log(QXmppLogger::SentMessage, QStringLiteral("<?xml version='1.0'?><stream:stream to='example.org'>"));
+	QVERIFY(!tracker->isEnabled());
+
+	log(QXmppLogger::ReceivedMessage, QStringLiteral("<resumed xmlns='urn:xmpp:sm:3' h='5' previd='1'/>"));
+	QVERIFY(tracker->isEnabled());
+	QVERIFY(tracker->isStreamResumed());
+	QCOMPARE(tracker->sentStanzas(), quint32(5));
+
+	QSignalSpy failedSpy(tracker, &StreamTracker::failed);
+	log(QXmppLogger::ReceivedMessage, QStringLiteral("<failed xmlns='urn:xmpp:sm:3'/>"));
+	QCOMPARE(failedSpy.size(), 1);
+	QVERIFY(!tracker->isEnabled());
+	QVERIFY(!tracker->isStreamResumed());
+}
+
+void StreamTrackerTest::testStreamFeatures()
+{
+	log(QXmppLogger::ReceivedMessage, QStringLiteral(
+		"<stream:features>"
+		"<c xmlns='http://jabber.org/protocol/caps' hash='sha-1' node='https://example.org' ver='ItBTI0XLDFvVxZ72NQElAzKS9sU='/>"
+		"<ver xmlns='urn:xmpp:features:rosterver'/>"
+		"</stream:features>"));
+	QCOMPARE(tracker->serverVerificationString(), QStringLiteral("ItBTI0XLDFvVxZ72NQElAzKS9sU="));
+	QVERIFY(tracker->isRosterVersioningSupported());
+
+	// The features are only valid for the current stream.
+	log(QXmppLogger::SentMessage, QStringLiteral("<stream:stream to='example.org'>"));
+	QVERIFY(tracker->serverVerificationString().isEmpty());
+	QVERIFY(!tracker->isRosterVersioningSupported());
+
+	// Only SHA-1 verification strings are supported.
+	log(QXmppLogger::ReceivedMessage, QStringLiteral(
+		"<stream:features><c xmlns='http://jabber.org/protocol/caps' hash='sha-256' ver='abc'/></stream:features>"));
+	QVERIFY(tracker->serverVerificationString().isEmpty());
+	QVERIFY(!tracker->isRosterVersioningSupported());
+}
+
+template<typename Stanza>
+void StreamTrackerTest::logSent(const Stanza &stanza)
+{
+	// serialized the same way as by QXmppStream::sendPacket()
+	QByteArray data;
+	QXmlStreamWriter writer(&data);
+	stanza.toXml(&writer);
+	log(QXmppLogger::SentMessage, QString::fromUtf8(data));
+}
+
+void StreamTrackerTest::log(QXmppLogger::MessageType type, const QString &text)
+{
+	// The client forwards the log messages of its stream to its logger.
+	emit client->logMessage(type, text);
+}
+
+void StreamTrackerTest::enableStreamManagement()
+{
+	log(QXmppLogger::SentMessage, QStringLiteral("<enable xmlns='urn:xmpp:sm:3' resume='true'/>"));
+	log(QXmppLogger::ReceivedMessage, QStringLiteral("<enabled xmlns='urn:xmpp:sm:3' id='1' resume='true'/>"));
+	QVERIFY(tracker->isEnabled());
+	QVERIFY(tracker->isResumptionPossible());
+	QCOMPARE(tracker->sentStanzas(), quint32(0));
+}
+
+QTEST_GUILESS_MAIN(StreamTrackerTest)
+#include "StreamTrackerTest.moc"
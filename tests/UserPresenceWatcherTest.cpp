@@ -17,6 +17,8 @@ class UserPresenceWatcherTest : public QObject
 private:
 	Q_SLOT void initTestCase();
 	Q_SLOT void testBasic();
+	Q_SLOT void benchmarkDispatch_data();
+	Q_SLOT void benchmarkDispatch();
 
 	void addBasicPresences();
 	void addSimplePresence(const QString &jid,
@@ -102,6 +104,45 @@ void UserPresenceWatcherTest::testBasic()
 	QCOMPARE(userModel.statusText(), QString());
 }
 
+void UserPresenceWatcherTest::benchmarkDispatch_data()
+{
+	QTest::addColumn<int>("watcherCount");
+
+	QTest::newRow("10 watchers") << 10;
+	QTest::newRow("100 watchers") << 100;
+	QTest::newRow("500 watchers") << 500;
+	QTest::newRow("2000 watchers") << 2000;
+}
+
+void UserPresenceWatcherTest::benchmarkDispatch()
+{
+	QFETCH(int, watcherCount);
+
+	cache.clear();
+
+	// one watcher and one presence per contact
+	std::vector<std::unique_ptr<UserPresenceWatcher>> watchers;
+	QVector<QXmppPresence> presences;
+	for (int i = 0; i < watcherCount; i++) {
+		const auto jid = QStringLiteral("contact%1@kaidan.im").arg(i);
+
+		auto &watcher = watchers.emplace_back(std::make_unique<UserPresenceWatcher>());
+		watcher->setJid(jid);
+
+		presences << simplePresence(jid + QStringLiteral("/dev1"));
+	}
+
+	QBENCHMARK {
+		for (const auto &presence : std::as_const(presences))
+			cache.updatePresence(presence);
+
+		QCoreApplication::sendPostedEvents(&cache, QEvent::MetaCall);
+	}
+
+	for (const auto &watcher : watchers)
+		QCOMPARE(watcher->resource(), "dev1");
+}
+
 void UserPresenceWatcherTest::addBasicPresences()
 {
 	addSimplePresence("bob@kaidan.im/dev1");
@@ -116,6 +157,9 @@ void UserPresenceWatcherTest::addSimplePresence(const QString &jid,
 	QXmppPresence::Type type)
 {
 	cache.updatePresence(simplePresence(jid, available, status, type));
+
+	// deliver the batched change notifications
+	QCoreApplication::sendPostedEvents(&cache, QEvent::MetaCall);
 }
 
 QXmppPresence UserPresenceWatcherTest::simplePresence(const QString &jid,